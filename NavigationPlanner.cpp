@@ -1,4 +1,13 @@
 #include <bits/stdc++.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
 // ===================== Building Data ADT =====================
@@ -186,116 +195,2448 @@ public:
     }
 };
 
+// ===================== Thread Pool =====================
+
+class ThreadPool {
+    vector<thread> workers;
+    queue<function<void()>> tasks;
+    mutex mtx;
+    condition_variable cv;
+    bool stopping;
+
+public:
+    explicit ThreadPool(unsigned threads = thread::hardware_concurrency()) : stopping(false) {
+        if (threads == 0) threads = 1;
+        for (unsigned i = 0; i < threads; i++) {
+            workers.emplace_back([this] {
+                while (true) {
+                    function<void()> task;
+                    {
+                        unique_lock<mutex> lock(mtx);
+                        cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                        if (stopping && tasks.empty()) return;
+                        task = std::move(tasks.front());
+                        tasks.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto &w : workers) w.join();
+    }
+
+    unsigned size() const { return (unsigned)workers.size(); }
+
+    // runs body(i) for every i in [0, count) on the pool and waits for all of them
+    void parallelFor(int count, const function<void(int)> &body) {
+        vector<future<void>> done;
+        done.reserve(count);
+        for (int i = 0; i < count; i++) {
+            auto task = make_shared<packaged_task<void()>>([&body, i] { body(i); });
+            done.push_back(task->get_future());
+            {
+                lock_guard<mutex> lock(mtx);
+                tasks.push([task] { (*task)(); });
+            }
+            cv.notify_one();
+        }
+        for (auto &f : done) f.get();
+    }
+};
+
+// ===================== Indexed 4-ary Heap =====================
+// Min-heap over vertex IDs with a position index, so decreaseKey moves an
+// entry in place instead of pushing a duplicate. Four children per node
+// halve the depth of a binary heap, and the four keys compared per level
+// sit in one cache line.
+
+class IndexedDaryHeap {
+    static constexpr int D = 4;
+    vector<int> heap;      // vertex IDs in heap order
+    vector<int> pos;       // index in heap, -1 when absent
+    vector<long long> key;
+
+    void siftUp(int i) {
+        int v = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (key[heap[parent]] <= key[v]) break;
+            heap[i] = heap[parent];
+            pos[heap[i]] = i;
+            i = parent;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+    void siftDown(int i) {
+        int n = (int)heap.size();
+        int v = heap[i];
+        while (true) {
+            int first = i * D + 1;
+            if (first >= n) break;
+            int best = first;
+            for (int c = first + 1; c < min(first + D, n); c++)
+                if (key[heap[c]] < key[heap[best]]) best = c;
+            if (key[heap[best]] >= key[v]) break;
+            heap[i] = heap[best];
+            pos[heap[i]] = i;
+            i = best;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+public:
+    void resize(int n) {
+        heap.clear();
+        pos.assign(n, -1);
+        key.assign(n, 0);
+    }
+
+    bool empty() const { return heap.empty(); }
+    bool contains(int v) const { return pos[v] >= 0; }
+    long long topKey() const { return key[heap[0]]; }
+
+    // inserts v, or lowers its key if k improves on it
+    void pushOrDecrease(int v, long long k) {
+        if (pos[v] < 0) {
+            key[v] = k;
+            heap.push_back(v);
+            siftUp((int)heap.size() - 1);
+        } else if (k < key[v]) {
+            key[v] = k;
+            siftUp(pos[v]);
+        }
+    }
+
+    int popMin() {
+        int top = heap[0];
+        pos[top] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return top;
+    }
+
+    // empties the heap in O(size), leaving it ready for the next search
+    void clear() {
+        for (int v : heap) pos[v] = -1;
+        heap.clear();
+    }
+};
+
+// Per-search state kept between queries. Only the vertices a search touched
+// are reset afterwards, so a short query on a huge graph costs what it visits.
+struct SearchSpace {
+    static constexpr long long INF = LLONG_MAX / 4;
+
+    vector<long long> dist;
+    vector<int> pred;
+    IndexedDaryHeap heap;
+    vector<int> touched;
+
+    void prepare(int n) {
+        if ((int)dist.size() != n) {
+            dist.assign(n, INF);
+            pred.assign(n, -1);
+            heap.resize(n);
+            touched.clear();
+            return;
+        }
+        for (int v : touched) {
+            dist[v] = INF;
+            pred[v] = -1;
+        }
+        touched.clear();
+        heap.clear();
+    }
+
+    // priority differs from d only for A*, where it adds the heuristic
+    void reach(int v, long long d, int from, long long priority) {
+        if (dist[v] == INF) touched.push_back(v);
+        dist[v] = d;
+        pred[v] = from;
+        heap.pushOrDecrease(v, priority);
+    }
+
+    void reach(int v, long long d, int from) { reach(v, d, from, d); }
+
+    vector<int> pathTo(int target) const {
+        vector<int> path;
+        for (int v = target; v != -1; v = pred[v]) path.push_back(v);
+        reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+struct ShortestPath {
+    long long distance; // SearchSpace::INF when unreachable
+    vector<int> path;   // src .. dst, empty when unreachable
+    size_t explored;    // vertices the search reached
+};
+
+enum class RouteMethod { Dijkstra, Bidirectional, Landmarks };
+
+// ===================== CSR Graph Layout =====================
+// Frozen compressed-sparse-row copy of the adjacency list. The neighbours of u
+// sit in targets/weights[offsets[u] .. offsets[u+1]), so walking them is one
+// contiguous read instead of a hop into a separately allocated vector.
+
+struct CsrGraph {
+    vector<int> offsets; // V + 1 entries
+    vector<int> targets;
+    vector<int> weights;
+
+    int vertexCount() const { return offsets.empty() ? 0 : (int)offsets.size() - 1; }
+    long long arcCount() const { return (long long)targets.size(); }
+
+    void build(const vector<vector<pair<int,int>>> &adj) {
+        int V = (int)adj.size();
+        offsets.assign(V + 1, 0);
+        for (int u = 0; u < V; u++) offsets[u + 1] = offsets[u] + (int)adj[u].size();
+        targets.resize(offsets[V]);
+        weights.resize(offsets[V]);
+        for (int u = 0; u < V; u++) {
+            int i = offsets[u];
+            for (auto &p : adj[u]) {
+                targets[i] = p.first;
+                weights[i++] = p.second;
+            }
+        }
+    }
+
+    template <typename F>
+    void forEachNeighbour(int u, F visit) const {
+        for (int i = offsets[u], end = offsets[u + 1]; i < end; i++) visit(targets[i], weights[i]);
+    }
+};
+
+// same interface over the mutable adjacency list
+struct AdjacencyView {
+    const vector<vector<pair<int,int>>> &adj;
+
+    int vertexCount() const { return (int)adj.size(); }
+
+    template <typename F>
+    void forEachNeighbour(int u, F visit) const {
+        for (auto &p : adj[u]) visit(p.first, p.second);
+    }
+};
+
+// ===================== Binary Graph File =====================
+// On-disk CSR snapshot: a fixed header, then four 8-byte aligned sections,
+// offsets (V + 1 ints), targets and weights (one int per arc) and building
+// names (V + 1 name offsets followed by the name bytes). open() maps the file
+// and points straight into it, so nothing is parsed or copied up front;
+// pages are faulted in as queries touch them.
+//
+// The header checksum is checked on open. verify() hashes the payload and
+// checks the structure (offsets ascending, targets in range), which is what
+// makes a file from elsewhere safe to walk.
+
+struct GraphFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    int32_t vertices;
+    int32_t reserved;
+    int64_t arcs;
+    uint64_t nameBytes;
+    uint64_t payloadBytes;
+    uint64_t payloadChecksum;
+    uint64_t headerChecksum; // over every field above
+};
+
+// Four independent multiply-xor lanes over 8-byte words, so hashing runs
+// near memory speed instead of waiting on one multiply per word
+uint64_t graphChecksum(const void *data, size_t bytes) {
+    const unsigned char *p = (const unsigned char *)data;
+    const uint64_t K = 0x9E3779B97F4A7C15ull;
+    uint64_t lane[4] = {K, K ^ 1, K ^ 2, K ^ 3};
+    size_t i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+        for (int k = 0; k < 4; k++) {
+            uint64_t w;
+            memcpy(&w, p + i + 8 * k, 8);
+            lane[k] = (lane[k] ^ w) * K;
+            lane[k] ^= lane[k] >> 32;
+        }
+    }
+    uint64_t h = bytes * K;
+    for (int k = 0; k < 4; k++) h = (h ^ lane[k]) * K;
+    for (; i < bytes; i++) h = (h ^ p[i]) * 0x100000001B3ull;
+    return h ^ (h >> 29);
+}
+
+class GraphFile {
+public:
+    static constexpr uint32_t MAGIC = 0x31524743; // "CGR1"
+    static constexpr uint32_t VERSION = 1;
+
+private:
+    const char *base = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    vector<uint64_t> buffer; // the whole file when mmap is unavailable
+    GraphFileHeader header{};
+    const int *offsetArr = nullptr, *targetArr = nullptr, *weightArr = nullptr;
+    const int *nameOffsetArr = nullptr;
+    const char *nameBytes = nullptr;
+    string lastError;
+
+    static size_t align8(size_t n) { return (n + 7) & ~(size_t)7; }
+
+    // section sizes in bytes, in file order
+    static array<size_t, 5> sectionSizes(int64_t vertices, int64_t arcs, uint64_t names) {
+        size_t vertexBytes = align8((size_t)(vertices + 1) * sizeof(int));
+        size_t arcBytes = align8((size_t)arcs * sizeof(int));
+        return {vertexBytes, arcBytes, arcBytes, vertexBytes, align8(names)};
+    }
+
+    bool fail(const string &why) {
+        close();
+        lastError = why;
+        return false;
+    }
+
+public:
+    GraphFile() = default;
+    GraphFile(const GraphFile &) = delete;
+    GraphFile& operator=(const GraphFile &) = delete;
+    ~GraphFile() { close(); }
+
+    bool open(const string &path) {
+        close();
+#ifdef __linux__
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) return fail("cannot open file");
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(GraphFileHeader)) {
+            ::close(fd);
+            return fail("not a graph file");
+        }
+        size = (size_t)st.st_size;
+        void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) return fail("cannot map file");
+        base = (const char *)map;
+        mapped = true;
+#else
+        ifstream in(path, ios::binary | ios::ate);
+        if (!in) return fail("cannot open file");
+        size = (size_t)in.tellg();
+        if (size < sizeof(GraphFileHeader)) return fail("not a graph file");
+        buffer.resize(align8(size) / 8);
+        in.seekg(0);
+        in.read((char *)buffer.data(), (streamsize)size);
+        if (!in) return fail("cannot read file");
+        base = (const char *)buffer.data();
+#endif
+        memcpy(&header, base, sizeof header);
+        if (header.magic != MAGIC || header.version != VERSION) return fail("not a graph file");
+        if (header.headerChecksum != graphChecksum(&header, offsetof(GraphFileHeader, headerChecksum)))
+            return fail("header checksum mismatch");
+        if (header.vertices < 0 || header.arcs < 0 || header.arcs > INT_MAX || header.nameBytes > size)
+            return fail("corrupt header");
+        auto sections = sectionSizes(header.vertices, header.arcs, header.nameBytes);
+        size_t payload = accumulate(sections.begin(), sections.end(), (size_t)0);
+        if (payload != header.payloadBytes || sizeof header + payload != size)
+            return fail("file size does not match header");
+        const char *p = base + sizeof header;
+        offsetArr = (const int *)p;
+        targetArr = (const int *)(p += sections[0]);
+        weightArr = (const int *)(p += sections[1]);
+        nameOffsetArr = (const int *)(p += sections[2]);
+        nameBytes = p + sections[3];
+        return true;
+    }
+
+    // payload checksum plus structural checks, including the non-negative
+    // weights every search relies on (as the edge list importer requires);
+    // closes the file on failure
+    bool verify() {
+        if (!base) return false;
+        if (graphChecksum(base + sizeof header, header.payloadBytes) != header.payloadChecksum)
+            return fail("payload checksum mismatch");
+        int n = header.vertices;
+        bool ok = offsetArr[0] == 0 && offsetArr[n] == header.arcs &&
+                  nameOffsetArr[0] == 0 && nameOffsetArr[n] == (int64_t)header.nameBytes;
+        for (int u = 0; ok && u < n; u++)
+            ok = offsetArr[u] <= offsetArr[u + 1] && nameOffsetArr[u] <= nameOffsetArr[u + 1];
+        for (int64_t i = 0; ok && i < header.arcs; i++)
+            ok = (unsigned)targetArr[i] < (unsigned)n && weightArr[i] >= 0;
+        return ok ? true : fail("corrupt graph structure");
+    }
+
+    void close() {
+#ifdef __linux__
+        if (mapped) munmap((void *)base, size);
+#endif
+        base = nullptr;
+        size = 0;
+        mapped = false;
+        buffer.clear();
+        header = {};
+        offsetArr = targetArr = weightArr = nameOffsetArr = nullptr;
+        nameBytes = nullptr;
+        lastError.clear();
+    }
+
+    bool isOpen() const { return base != nullptr; }
+    const string& error() const { return lastError; }
+    int vertexCount() const { return header.vertices; }
+    long long arcCount() const { return header.arcs; }
+    const int* offsets() const { return offsetArr; }
+    const int* targets() const { return targetArr; }
+    const int* weights() const { return weightArr; }
+
+    string name(int v) const {
+        return string(nameBytes + nameOffsetArr[v], nameBytes + nameOffsetArr[v + 1]);
+    }
+
+    template <typename F>
+    void forEachNeighbour(int u, F visit) const {
+        for (int i = offsetArr[u], end = offsetArr[u + 1]; i < end; i++) visit(targetArr[i], weightArr[i]);
+    }
+
+    // The payload is assembled in one buffer so it is hashed and written in
+    // a single pass each; names past the end of the list are stored empty
+    static bool write(const string &path, const CsrGraph &g, const vector<string> &names) {
+        int n = g.vertexCount();
+        vector<int> nameOffsets(n + 1, 0);
+        string nameData;
+        for (int v = 0; v < n; v++) {
+            if (v < (int)names.size()) nameData += names[v];
+            nameOffsets[v + 1] = (int)nameData.size();
+        }
+        GraphFileHeader h{};
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.vertices = n;
+        h.arcs = g.arcCount();
+        h.nameBytes = nameData.size();
+        auto sections = sectionSizes(h.vertices, h.arcs, h.nameBytes);
+        h.payloadBytes = accumulate(sections.begin(), sections.end(), (size_t)0);
+
+        vector<char> payload(h.payloadBytes, 0);
+        char *p = payload.data();
+        auto put = [&p](const void *src, size_t bytes, size_t section) {
+            if (bytes) memcpy(p, src, bytes);
+            p += section;
+        };
+        if (n > 0) put(g.offsets.data(), g.offsets.size() * sizeof(int), sections[0]);
+        else p += sections[0]; // the lone offset is already zero
+        put(g.targets.data(), g.targets.size() * sizeof(int), sections[1]);
+        put(g.weights.data(), g.weights.size() * sizeof(int), sections[2]);
+        put(nameOffsets.data(), nameOffsets.size() * sizeof(int), sections[3]);
+        put(nameData.data(), nameData.size(), sections[4]);
+        h.payloadChecksum = graphChecksum(payload.data(), payload.size());
+        h.headerChecksum = graphChecksum(&h, offsetof(GraphFileHeader, headerChecksum));
+
+        ofstream out(path, ios::binary);
+        if (!out) return false;
+        out.write((const char *)&h, sizeof h);
+        out.write(payload.data(), (streamsize)payload.size());
+        return (bool)out;
+    }
+};
+
+// ===================== Edge List Import =====================
+// DIMACS-style text: "c" comment lines, an optional "p <kind> <n> <m>" line
+// and one "a u v w" (or "e u v [w]") line per path with 1-based building
+// IDs; a missing weight is 1. Every line becomes a two-way path, so a file
+// that lists both directions of a road yields parallel copies. Without a
+// "p" line the largest ID sets the building count.
+//
+// Like the student CSV import, the file is mapped and split at line breaks
+// across the pool; the CSR arrays are then filled by a counting sort on the
+// endpoints, keeping file order within each building.
+
+struct EdgeListImportStats {
+    size_t bytes = 0;
+    long long edges = 0;
+    size_t malformed = 0;
+};
+
+struct ImportedEdge { int u, v, w; };
+
+const char* skipBlanks(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    return p;
+}
+
+// "a u v w" / "e u v [w]" with the tag still in front; IDs stay 1-based
+bool parseEdgeLine(const char *p, const char *end, ImportedEdge &e) {
+    if (end > p && end[-1] == '\r') end--;
+    int vals[3] = {0, 0, 1};
+    int got = 0;
+    for (p++; got < 3; got++) {
+        p = skipBlanks(p, end);
+        if (p == end) break;
+        auto r = from_chars(p, end, vals[got]);
+        if (r.ec != errc()) return false;
+        p = r.ptr;
+    }
+    if (got < 2 || skipBlanks(p, end) != end || vals[2] < 0) return false;
+    e = {vals[0], vals[1], vals[2]};
+    return true;
+}
+
+void parseEdgeChunk(const char *p, const char *end, vector<ImportedEdge> &out, size_t &malformed) {
+    ImportedEdge e;
+    while (p < end) {
+        const char *eol = (const char *)memchr(p, '\n', end - p);
+        if (!eol) eol = end;
+        if (*p == 'a' || *p == 'e') {
+            if (parseEdgeLine(p, eol, e)) out.push_back(e);
+            else malformed++;
+        } else if (*p != 'c' && *p != 'p' && *p != '\n' && *p != '\r') {
+            malformed++;
+        }
+        p = eol + 1;
+    }
+}
+
+// the building count from the "p" line among the leading comment lines,
+// -1 when there is none; false when the line is unreadable
+bool parseProblemLine(const char *p, const char *end, int &vertices) {
+    vertices = -1;
+    while (p < end && (*p == 'c' || *p == 'p' || *p == '\n' || *p == '\r')) {
+        const char *eol = (const char *)memchr(p, '\n', end - p);
+        if (!eol) eol = end;
+        if (*p == 'p') {
+            const char *q = skipBlanks(p + 1, eol);
+            while (q < eol && *q != ' ' && *q != '\t') q++; // "sp", "edge", ...
+            auto r = from_chars(skipBlanks(q, eol), eol, vertices);
+            return r.ec == errc() && vertices >= 0;
+        }
+        p = eol + 1;
+    }
+    return true;
+}
+
+bool parseEdgeList(const char *data, size_t size, ThreadPool &pool,
+                   CsrGraph &out, EdgeListImportStats &stats) {
+    const char *begin = data, *end = data + size;
+    int declared;
+    if (!parseProblemLine(begin, end, declared)) return false;
+
+    int chunks = (int)pool.size() * 4;
+    if (size < (1u << 20)) chunks = 1;
+    vector<const char *> cuts(chunks + 1, end);
+    cuts[0] = begin;
+    for (int c = 1; c < chunks; c++) {
+        const char *guess = max(cuts[c - 1], begin + (end - begin) * c / chunks);
+        const char *eol = (const char *)memchr(guess, '\n', end - guess);
+        cuts[c] = eol ? eol + 1 : end;
+    }
+
+    vector<vector<ImportedEdge>> parts(chunks);
+    vector<size_t> bad(chunks, 0);
+    pool.parallelFor(chunks, [&](int c) {
+        parts[c].reserve((cuts[c + 1] - cuts[c]) / 16);
+        parseEdgeChunk(cuts[c], cuts[c + 1], parts[c], bad[c]);
+    });
+    stats.bytes = size;
+    stats.edges = 0;
+    stats.malformed = accumulate(bad.begin(), bad.end(), (size_t)0);
+
+    int n = declared;
+    size_t parsed = 0;
+    for (const auto &part : parts) parsed += part.size();
+    if (n < 0) {
+        n = 0;
+        for (const auto &part : parts)
+            for (const auto &e : part) n = max({n, e.u, e.v});
+    }
+    // Every building costs a dozen bytes of CSR, so a stray ID or "p" count
+    // in a small file could ask for gigabytes. Beyond the endpoints of the
+    // parsed edges, allow no more buildings than the file has bytes.
+    if ((uint64_t)n > 2 * (uint64_t)parsed + size) return false;
+
+    // degree count, dropping edges whose IDs fall outside 1..n
+    vector<long long> degree((size_t)n + 1, 0);
+    for (auto &part : parts) {
+        for (auto &e : part) {
+            if (e.u < 1 || e.v < 1 || e.u > n || e.v > n) {
+                e.u = 0;
+                stats.malformed++;
+                continue;
+            }
+            degree[e.u]++;
+            degree[e.v]++;
+            stats.edges++;
+        }
+    }
+    if (2 * stats.edges > INT_MAX) return false; // CSR offsets are int
+
+    out.offsets.assign((size_t)n + 1, 0);
+    for (int v = 0; v < n; v++) out.offsets[v + 1] = out.offsets[v] + (int)degree[v + 1];
+    out.targets.resize(2 * stats.edges);
+    out.weights.resize(2 * stats.edges);
+    vector<int> cursor(out.offsets.begin(), out.offsets.end() - 1);
+    for (const auto &part : parts) {
+        for (const auto &e : part) {
+            if (e.u == 0) continue;
+            int a = e.u - 1, b = e.v - 1;
+            out.targets[cursor[a]] = b;
+            out.weights[cursor[a]++] = e.w;
+            out.targets[cursor[b]] = a;
+            out.weights[cursor[b]++] = e.w;
+        }
+    }
+    return true;
+}
+
+bool loadEdgeList(const string &path, ThreadPool &pool, CsrGraph &out, EdgeListImportStats &stats) {
+#ifdef __linux__
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size_t size = (size_t)st.st_size;
+    if (size == 0) {
+        close(fd);
+        out = CsrGraph();
+        out.offsets.assign(1, 0);
+        stats = EdgeListImportStats();
+        return true;
+    }
+    void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+    madvise(map, size, MADV_SEQUENTIAL);
+    bool ok = parseEdgeList((const char *)map, size, pool, out, stats);
+    munmap(map, size);
+    return ok;
+#else
+    ifstream in(path, ios::binary);
+    if (!in) return false;
+    string data((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    return parseEdgeList(data.data(), data.size(), pool, out, stats);
+#endif
+}
+
+// ===================== Distance Matrix =====================
+// Row-major table of int distances: row r holds the distances from
+// sources[r] to every vertex. Unreachable entries, and any distance that
+// reaches CampusGraph::INF, are stored as INF, the same convention dijkstra()
+// prints.
+
+struct DistanceMatrix {
+    vector<int> sources;
+    int columns = 0;
+    vector<int> dist;
+
+    int at(int row, int col) const { return dist[(size_t)row * columns + col]; }
+    int* row(int r) { return &dist[(size_t)r * columns]; }
+};
+
+enum class MatrixMethod { Auto, Dijkstra, FloydWarshall };
+
+// ===================== Disjoint Set (union-find) =====================
+// Union by size with iterative path halving: every other node on the walk
+// to the root is pointed at its grandparent, so no recursion and no second
+// pass is needed.
+
+class DisjointSet {
+    vector<int> parent;
+    vector<int> setSize;
+
+public:
+    explicit DisjointSet(int n = 0) { reset(n); }
+
+    void reset(int n) {
+        parent.resize(n);
+        iota(parent.begin(), parent.end(), 0);
+        setSize.assign(n, 1);
+    }
+
+    int find(int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // false when a and b were already connected
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (setSize[a] < setSize[b]) swap(a, b);
+        parent[b] = a;
+        setSize[a] += setSize[b];
+        return true;
+    }
+};
+
+// Lock-free variant for parallel Boruvka. A root is always linked under the
+// smaller-indexed root with one CAS, so parents only point to lower
+// indices and no cycle can form. find() halves paths with CAS too; a lost
+// race just leaves a slightly longer path.
+class ConcurrentDisjointSet {
+    unique_ptr<atomic<int>[]> parent;
+
+public:
+    explicit ConcurrentDisjointSet(int n) : parent(new atomic<int>[n]) {
+        for (int i = 0; i < n; i++) parent[i].store(i, memory_order_relaxed);
+    }
+
+    int find(int x) {
+        while (true) {
+            int p = parent[x].load();
+            if (p == x) return x;
+            int gp = parent[p].load();
+            if (gp != p) parent[x].compare_exchange_weak(p, gp);
+            x = gp;
+        }
+    }
+
+    bool unite(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (a < b) swap(a, b);
+            int expected = a;
+            if (parent[a].compare_exchange_strong(expected, b)) return true;
+        }
+    }
+};
+
 // ===================== Graph (Adjacency List) =====================
 
 class CampusGraph {
+public:
+    struct Edge { int u, v, w; };
+
+private:
     int V;
     vector<vector<pair<int,int>>> adj; // to, weight
     vector<string> buildingNames;
+    CsrGraph csr;
+    bool frozen = false; // csr matches adj
+    SearchSpace search;  // reused by point-to-point queries
+    SearchSpace reverseSearch;
+
+    // ALT: exact distances from a few landmarks, interleaved per vertex
+    // (landmarkDist[v * landmarks.size() + i]), built on the first A* query
+    // after the graph changes
+    vector<int> landmarks;
+    vector<long long> landmarkDist;
+    bool landmarksReady = false;
+
+    // every edge once (u < v), sorted by weight; kept until the graph changes
+    // so repeated MST runs skip the gather and the sort
+    vector<Edge> sortedEdges;
+    bool edgesReady = false;
+    DisjointSet components;
+
+    // LSD radix sort on weight, 16 bits per pass. Weights are flipped to
+    // unsigned order first, and a pass is skipped when every edge shares its
+    // digit, so small campus weights sort in a single counting pass.
+    static void radixSortByWeight(vector<Edge> &edges) {
+        vector<Edge> buffer(edges.size());
+        for (int shift = 0; shift < 32; shift += 16) {
+            vector<size_t> count(1 << 16, 0);
+            for (const Edge &e : edges) count[(((uint32_t)e.w ^ 0x80000000u) >> shift) & 0xFFFF]++;
+            if (!edges.empty() && count[(((uint32_t)edges[0].w ^ 0x80000000u) >> shift) & 0xFFFF] == edges.size())
+                continue;
+            size_t sum = 0;
+            for (auto &c : count) {
+                size_t here = c;
+                c = sum;
+                sum += here;
+            }
+            for (const Edge &e : edges) buffer[count[(((uint32_t)e.w ^ 0x80000000u) >> shift) & 0xFFFF]++] = e;
+            edges.swap(buffer);
+        }
+    }
+
+    void prepareSortedEdges() {
+        if (edgesReady) return;
+        sortedEdges.clear();
+        long long arcs = 0;
+        for (auto &list : adj) arcs += (long long)list.size();
+        sortedEdges.reserve(arcs / 2);
+        for (int u = 0; u < V; u++) {
+            for (auto &p : adj[u]) {
+                if (u < p.first) sortedEdges.push_back({u, p.first, p.second});
+            }
+        }
+        radixSortByWeight(sortedEdges);
+        edgesReady = true;
+    }
+
+    // Shortest-path trees for recently queried sources, kept correct across
+    // edits by repairing only the part of each tree an edit can change
+    // (Ramalingam-Reps). An edge that gets shorter, or is added, can only
+    // improve distances, so a Dijkstra seeded at its far endpoint spreads the
+    // gain. An edge that gets longer, or is removed, can only hurt the
+    // subtree hanging below it, if it is a tree edge. Those vertices are
+    // reset, re-seeded from their unaffected neighbours, and settled again.
+    struct CachedTree {
+        int source;
+        vector<long long> dist;
+        vector<int> pred;
+        unsigned long long lastUse;
+    };
+    static constexpr int CACHED_TREES = 8;
+    vector<CachedTree> cachedTrees;
+    unsigned long long cacheClock = 0;
+    IndexedDaryHeap repairHeap;
+    vector<char> affected;
+
+    void invalidateDerived() {
+        frozen = false;
+        landmarksReady = false;
+        edgesReady = false;
+    }
+
+    void prepareRepair() {
+        if ((int)affected.size() != V) {
+            repairHeap.resize(V);
+            affected.assign(V, 0);
+        }
+    }
+
+    // settles the repair heap into t, relaxing through the current graph
+    void propagate(CachedTree &t) {
+        while (!repairHeap.empty()) {
+            int u = repairHeap.popMin();
+            long long du = t.dist[u];
+            for (auto &p : adj[u]) {
+                if (du + p.second < t.dist[p.first]) {
+                    t.dist[p.first] = du + p.second;
+                    t.pred[p.first] = u;
+                    repairHeap.pushOrDecrease(p.first, t.dist[p.first]);
+                }
+            }
+        }
+    }
+
+    // edge a-b now exists with weight w (new, or lighter than before)
+    void repairAfterDecrease(CachedTree &t, int a, int b, int w) {
+        prepareRepair();
+        for (int side = 0; side < 2; side++, swap(a, b)) {
+            if (t.dist[a] != SearchSpace::INF && t.dist[a] + w < t.dist[b]) {
+                t.dist[b] = t.dist[a] + w;
+                t.pred[b] = a;
+                repairHeap.pushOrDecrease(b, t.dist[b]);
+            }
+        }
+        propagate(t);
+    }
+
+    // edge a-b got heavier or disappeared
+    void repairAfterIncrease(CachedTree &t, int a, int b) {
+        int child = t.pred[b] == a ? b : t.pred[a] == b ? a : -1;
+        if (child == -1) return; // not a tree edge: no distance can change
+        prepareRepair();
+        vector<int> subtree{child};
+        affected[child] = 1;
+        for (size_t i = 0; i < subtree.size(); i++) {
+            int x = subtree[i];
+            for (auto &p : adj[x]) {
+                if (!affected[p.first] && t.pred[p.first] == x) {
+                    affected[p.first] = 1;
+                    subtree.push_back(p.first);
+                }
+            }
+        }
+        for (int x : subtree) {
+            t.dist[x] = SearchSpace::INF;
+            t.pred[x] = -1;
+        }
+        for (int x : subtree) {
+            for (auto &p : adj[x]) {
+                int y = p.first;
+                if (affected[y] || t.dist[y] == SearchSpace::INF) continue;
+                if (t.dist[y] + p.second < t.dist[x]) {
+                    t.dist[x] = t.dist[y] + p.second;
+                    t.pred[x] = y;
+                }
+            }
+            if (t.dist[x] != SearchSpace::INF) repairHeap.pushOrDecrease(x, t.dist[x]);
+        }
+        for (int x : subtree) affected[x] = 0;
+        propagate(t);
+    }
 
 public:
+    static constexpr int INF = 1000000000;
+
     CampusGraph(int v = 0) : V(v), adj(v), buildingNames(v) {}
 
-    void reset(int v) {
-        V = v;
-        adj.assign(v, {});
-        buildingNames.assign(v, "");
+    void reset(int v) {
+        V = v;
+        adj.assign(v, {});
+        buildingNames.assign(v, "");
+        invalidateDerived();
+        cachedTrees.clear();
+        affected.clear();
+    }
+
+    int vertexCount() const { return V; }
+
+    void setBuildingName(int idx, const string &name) {
+        if (idx >= 0 && idx < V) buildingNames[idx] = name;
+    }
+
+    // Every search and the cached-tree repair assume non-negative distances,
+    // so addEdge and updateWeight refuse w < 0 and leave the graph unchanged.
+    // false for an unknown building or a negative distance
+    bool addEdge(int u, int v, int w) {
+        if (u < 0 || v < 0 || u >= V || v >= V || w < 0) return false;
+        adj[u].push_back({v, w});
+        adj[v].push_back({u, w});
+        invalidateDerived();
+        if (u != v)
+            for (auto &t : cachedTrees) repairAfterDecrease(t, u, v, w);
+        return true;
+    }
+
+    // closes every path between u and v; false when there was none
+    bool removeEdge(int u, int v) {
+        if (u < 0 || v < 0 || u >= V || v >= V) return false;
+        auto drop = [this](int a, int b) {
+            auto &list = adj[a];
+            size_t before = list.size();
+            list.erase(remove_if(list.begin(), list.end(),
+                                 [b](const pair<int,int> &p) { return p.first == b; }),
+                       list.end());
+            return list.size() != before;
+        };
+        if (!drop(u, v)) return false;
+        if (u != v) drop(v, u);
+        invalidateDerived();
+        if (u != v)
+            for (auto &t : cachedTrees) repairAfterIncrease(t, u, v);
+        return true;
+    }
+
+    // sets the length of every path between u and v to w; false when there
+    // was none or w is negative
+    bool updateWeight(int u, int v, int w) {
+        if (u < 0 || v < 0 || u >= V || v >= V || w < 0) return false;
+        bool found = false;
+        int old = 0;
+        for (auto &p : adj[u]) {
+            if (p.first != v) continue;
+            old = found ? min(old, p.second) : p.second;
+            found = true;
+            p.second = w;
+        }
+        if (!found) return false;
+        if (u != v)
+            for (auto &p : adj[v])
+                if (p.first == u) p.second = w;
+        invalidateDerived();
+        if (u == v || w == old) return true;
+        for (auto &t : cachedTrees) {
+            if (w < old) repairAfterDecrease(t, u, v, w);
+            else repairAfterIncrease(t, u, v);
+        }
+        return true;
+    }
+
+    // Distances from src, served from the tree cache when src was queried
+    // recently; otherwise one full search, evicting the least recently used
+    // tree. Empty for an invalid source.
+    const vector<long long>& cachedDistances(int src) {
+        static const vector<long long> none;
+        if (src < 0 || src >= V) return none;
+        for (auto &t : cachedTrees) {
+            if (t.source == src) {
+                t.lastUse = ++cacheClock;
+                return t.dist;
+            }
+        }
+        CachedTree *slot;
+        if ((int)cachedTrees.size() < CACHED_TREES) {
+            cachedTrees.push_back({});
+            slot = &cachedTrees.back();
+        } else {
+            slot = &*min_element(cachedTrees.begin(), cachedTrees.end(),
+                                 [](const CachedTree &a, const CachedTree &b) { return a.lastUse < b.lastUse; });
+        }
+        if (frozen) settleAll(csr, src, search);
+        else settleAll(AdjacencyView{adj}, src, search);
+        slot->source = src;
+        slot->dist = search.dist;
+        slot->pred = search.pred;
+        slot->lastUse = ++cacheClock;
+        return slot->dist;
+    }
+
+    int cachedSourceCount() const { return (int)cachedTrees.size(); }
+
+    // Build the CSR copy once the graph is complete; any later edit drops it
+    // and the algorithms fall back to the adjacency list until the next freeze
+    void freeze() {
+        csr.build(adj);
+        frozen = true;
+    }
+
+    bool isFrozen() const { return frozen; }
+
+    // writes the CSR snapshot, freezing first, together with the building names
+    bool saveBinary(const string &path) {
+        if (!frozen) freeze();
+        return GraphFile::write(path, csr, buildingNames);
+    }
+
+    // Replaces the graph with an opened graph file: the CSR arrays are copied
+    // straight out of the mapping and the adjacency lists rebuilt from them
+    void assign(const GraphFile &file) {
+        reset(file.vertexCount());
+        const int *off = file.offsets(), *to = file.targets(), *wt = file.weights();
+        csr.offsets.assign(off, off + V + 1);
+        csr.targets.assign(to, to + file.arcCount());
+        csr.weights.assign(wt, wt + file.arcCount());
+        for (int u = 0; u < V; u++) {
+            buildingNames[u] = file.name(u);
+            adj[u].reserve(off[u + 1] - off[u]);
+            for (int i = off[u]; i < off[u + 1]; i++) adj[u].push_back({to[i], wt[i]});
+        }
+        frozen = true;
+    }
+
+    // lets CampusGraph itself be passed wherever a layout is expected
+    template <typename F>
+    void forEachNeighbour(int u, F visit) const {
+        if (frozen) csr.forEachNeighbour(u, visit);
+        else AdjacencyView{adj}.forEachNeighbour(u, visit);
+    }
+
+    void printGraph() {
+        for (int i = 0; i < V; i++) {
+            cout << "Building " << i << " (" << buildingNames[i] << ") -> ";
+            for (auto &p : adj[i]) {
+                cout << "[" << p.first << " (w=" << p.second << ")] ";
+            }
+            cout << "\n";
+        }
+    }
+
+    template <typename Layout>
+    static vector<int> shortestDistances(const Layout &g, int src) {
+        vector<int> dist(g.vertexCount(), INF);
+        dist[src] = 0;
+        using P = pair<int,int>;
+        priority_queue<P, vector<P>, greater<P>> pq;
+        pq.push({0, src});
+
+        while (!pq.empty()) {
+            auto [d, u] = pq.top(); pq.pop();
+            if (d != dist[u]) continue;
+            g.forEachNeighbour(u, [&](int v, int w) {
+                if (d + w < dist[v]) {
+                    dist[v] = d + w;
+                    pq.push({dist[v], v});
+                }
+            });
+        }
+        return dist;
+    }
+
+    // Dijkstra that stops as soon as dst is settled; 64-bit distances
+    template <typename Layout>
+    static ShortestPath shortestPath(const Layout &g, int src, int dst, SearchSpace &s) {
+        int n = g.vertexCount();
+        if (src < 0 || dst < 0 || src >= n || dst >= n) return {SearchSpace::INF, {}, 0};
+        s.prepare(n);
+        s.reach(src, 0, -1);
+        while (!s.heap.empty()) {
+            int u = s.heap.popMin();
+            if (u == dst) return {s.dist[dst], s.pathTo(dst), s.touched.size()};
+            long long du = s.dist[u];
+            g.forEachNeighbour(u, [&](int v, int w) {
+                if (du + w < s.dist[v]) s.reach(v, du + w, u);
+            });
+        }
+        return {SearchSpace::INF, {}, s.touched.size()};
+    }
+
+    // Searches from both ends and stops once the two frontiers' smallest keys
+    // add up to the best meeting distance; each side covers roughly a disc
+    // of half the radius. The graph is undirected, so both sides walk the
+    // same neighbour lists.
+    template <typename Layout>
+    static ShortestPath bidirectionalPath(const Layout &g, int src, int dst,
+                                          SearchSpace &fw, SearchSpace &bw) {
+        int n = g.vertexCount();
+        if (src < 0 || dst < 0 || src >= n || dst >= n) return {SearchSpace::INF, {}, 0};
+        if (src == dst) return {0, {src}, 1};
+        fw.prepare(n);
+        bw.prepare(n);
+        fw.reach(src, 0, -1);
+        bw.reach(dst, 0, -1);
+        long long best = SearchSpace::INF;
+        int meet = -1;
+        while (!fw.heap.empty() && !bw.heap.empty()) {
+            if (fw.heap.topKey() + bw.heap.topKey() >= best) break;
+            bool forward = fw.heap.topKey() <= bw.heap.topKey();
+            SearchSpace &s = forward ? fw : bw;
+            SearchSpace &other = forward ? bw : fw;
+            int u = s.heap.popMin();
+            long long du = s.dist[u];
+            g.forEachNeighbour(u, [&](int v, int w) {
+                long long dv = du + w;
+                if (dv < s.dist[v]) s.reach(v, dv, u);
+                if (other.dist[v] != SearchSpace::INF && dv + other.dist[v] < best) {
+                    best = dv + other.dist[v];
+                    meet = v;
+                }
+            });
+        }
+        size_t explored = fw.touched.size() + bw.touched.size();
+        if (meet == -1) return {SearchSpace::INF, {}, explored};
+        vector<int> path = fw.pathTo(meet);
+        for (int v = bw.pred[meet]; v != -1; v = bw.pred[v]) path.push_back(v);
+        return {best, path, explored};
+    }
+
+    // full single-source search; distances are left in s.dist
+    template <typename Layout>
+    static void settleAll(const Layout &g, int src, SearchSpace &s) {
+        s.prepare(g.vertexCount());
+        s.reach(src, 0, -1);
+        while (!s.heap.empty()) {
+            int u = s.heap.popMin();
+            long long du = s.dist[u];
+            g.forEachNeighbour(u, [&](int v, int w) {
+                if (du + w < s.dist[v]) s.reach(v, du + w, u);
+            });
+        }
+    }
+
+    // Farthest-point selection: each new landmark is the vertex furthest from
+    // all landmarks chosen so far, which spreads them around the periphery
+    // where their triangle-inequality bounds are tightest
+    template <typename Layout>
+    void buildLandmarks(const Layout &g, int count) {
+        int n = g.vertexCount();
+        count = min(count, n);
+        landmarks.clear();
+        landmarkDist.assign((size_t)n * count, SearchSpace::INF);
+        vector<long long> nearest(n, SearchSpace::INF);
+        int next = 0;
+        settleAll(g, next, search); // seed: furthest vertex from vertex 0
+        for (int v = 0; v < n; v++)
+            if (search.dist[v] != SearchSpace::INF && search.dist[v] > search.dist[next]) next = v;
+        for (int i = 0; i < count; i++) {
+            landmarks.push_back(next);
+            settleAll(g, next, search);
+            for (int v = 0; v < n; v++) {
+                landmarkDist[(size_t)v * count + i] = search.dist[v];
+                nearest[v] = min(nearest[v], search.dist[v]);
+            }
+            // vertices no landmark reaches yet come first, then the furthest
+            next = 0;
+            for (int v = 1; v < n; v++)
+                if (nearest[v] > nearest[next]) next = v;
+        }
+        search.prepare(n);
+        landmarksReady = true;
+    }
+
+    // lower bound on dist(v, dst) from |d(L, dst) - d(L, v)|; INF when some
+    // landmark proves dst is in another component
+    long long landmarkBound(int v, int dst) const {
+        size_t k = landmarks.size();
+        const long long *lv = &landmarkDist[(size_t)v * k];
+        const long long *lt = &landmarkDist[(size_t)dst * k];
+        long long bound = 0;
+        for (size_t i = 0; i < k; i++) {
+            if (lv[i] == SearchSpace::INF || lt[i] == SearchSpace::INF) {
+                if (lv[i] != lt[i]) return SearchSpace::INF;
+                continue;
+            }
+            bound = max(bound, lv[i] > lt[i] ? lv[i] - lt[i] : lt[i] - lv[i]);
+        }
+        return bound;
+    }
+
+    // A* ordered by dist + landmark bound; the bound is consistent, so a
+    // vertex is final when popped, as in plain Dijkstra
+    template <typename Layout>
+    ShortestPath landmarkPath(const Layout &g, int src, int dst) {
+        int n = g.vertexCount();
+        if (src < 0 || dst < 0 || src >= n || dst >= n) return {SearchSpace::INF, {}, 0};
+        if (!landmarksReady) buildLandmarks(g, LANDMARK_COUNT);
+        if (landmarkBound(src, dst) == SearchSpace::INF) return {SearchSpace::INF, {}, 0};
+        SearchSpace &s = search;
+        s.prepare(n);
+        s.reach(src, 0, -1, landmarkBound(src, dst));
+        while (!s.heap.empty()) {
+            int u = s.heap.popMin();
+            if (u == dst) return {s.dist[dst], s.pathTo(dst), s.touched.size()};
+            long long du = s.dist[u];
+            g.forEachNeighbour(u, [&](int v, int w) {
+                long long dv = du + w;
+                if (dv < s.dist[v]) s.reach(v, dv, u, dv + landmarkBound(v, dst));
+            });
+        }
+        return {SearchSpace::INF, {}, s.touched.size()};
+    }
+
+    template <typename Layout>
+    static vector<Edge> minimumSpanningTree(const Layout &g) {
+        int n = g.vertexCount();
+        vector<Edge> edges;
+        for (int u = 0; u < n; u++) {
+            g.forEachNeighbour(u, [&](int v, int w) {
+                if (u < v) edges.push_back({u, v, w});
+            });
+        }
+        sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {
+            return a.w < b.w;
+        });
+
+        vector<int> parent(n), rankV(n, 0);
+        iota(parent.begin(), parent.end(), 0);
+
+        function<int(int)> findSet = [&](int x) {
+            if (parent[x] == x) return x;
+            return parent[x] = findSet(parent[x]);
+        };
+
+        auto unionSet = [&](int a, int b) {
+            a = findSet(a);
+            b = findSet(b);
+            if (a != b) {
+                if (rankV[a] < rankV[b]) swap(a,b);
+                parent[b] = a;
+                if (rankV[a] == rankV[b]) rankV[a]++;
+                return true;
+            }
+            return false;
+        };
+
+        vector<Edge> tree;
+        for (auto &e : edges) {
+            if (unionSet(e.u, e.v)) tree.push_back(e);
+        }
+        return tree;
+    }
+
+    // Kruskal over the cached, weight-sorted edge array; stops as soon as
+    // V - 1 edges are in, which on a connected graph is usually well before
+    // the heaviest edges are reached
+    vector<Edge> kruskalFast() {
+        prepareSortedEdges();
+        components.reset(V);
+        vector<Edge> tree;
+        tree.reserve(V > 0 ? V - 1 : 0);
+        for (const Edge &e : sortedEdges) {
+            if (!components.unite(e.u, e.v)) continue;
+            tree.push_back(e);
+            if ((int)tree.size() == V - 1) break;
+        }
+        return tree;
+    }
+
+    // Parallel Boruvka. Each round, every edge offers itself as the lightest
+    // exit of both endpoint components (an atomic min on a packed
+    // weight/index key, so ties break by index and no cycle can be chosen),
+    // then every component joins along its lightest exit, and edges now
+    // inside one component are filtered out. Components at least halve each
+    // round, so there are O(log V) rounds of parallel, mostly sequential
+    // scans.
+    vector<Edge> boruvkaParallel(ThreadPool &pool) const {
+        int chunks = (int)pool.size() * 4;
+        auto chunkRange = [](long long total, int parts, int c) {
+            return make_pair(total * c / parts, total * (c + 1) / parts);
+        };
+
+        // gather each edge once (u < v): count per vertex chunk, prefix, fill
+        vector<long long> start(chunks + 1, 0);
+        pool.parallelFor(chunks, [&](int c) {
+            auto [lo, hi] = chunkRange(V, chunks, c);
+            long long count = 0;
+            for (long long u = lo; u < hi; u++)
+                for (auto &p : adj[u]) count += u < p.first;
+            start[c + 1] = count;
+        });
+        for (int c = 0; c < chunks; c++) start[c + 1] += start[c];
+        vector<Edge> edges(start[chunks]);
+        pool.parallelFor(chunks, [&](int c) {
+            auto [lo, hi] = chunkRange(V, chunks, c);
+            long long out = start[c];
+            for (long long u = lo; u < hi; u++)
+                for (auto &p : adj[u])
+                    if (u < p.first) edges[out++] = {(int)u, p.first, p.second};
+        });
+
+        ConcurrentDisjointSet sets(V);
+        unique_ptr<atomic<uint64_t>[]> best(new atomic<uint64_t>[V]);
+        const uint64_t NONE = UINT64_MAX;
+        for (int v = 0; v < V; v++) best[v].store(NONE, memory_order_relaxed);
+        vector<Edge> tree;
+        mutex treeMtx;
+        vector<Edge> kept;
+
+        while (!edges.empty()) {
+            long long m = (long long)edges.size();
+            // 1. lightest exit per component
+            pool.parallelFor(chunks, [&](int c) {
+                auto [lo, hi] = chunkRange(m, chunks, c);
+                for (long long i = lo; i < hi; i++) {
+                    int ru = sets.find(edges[i].u), rv = sets.find(edges[i].v);
+                    if (ru == rv) continue;
+                    uint64_t key = (uint64_t)((uint32_t)edges[i].w ^ 0x80000000u) << 32 | (uint64_t)i;
+                    for (int r : {ru, rv}) {
+                        uint64_t cur = best[r].load(memory_order_relaxed);
+                        while (key < cur && !best[r].compare_exchange_weak(cur, key, memory_order_relaxed)) {}
+                    }
+                }
+            });
+            // 2. join along them; a second offer of the same edge fails to unite
+            atomic<bool> joined{false};
+            pool.parallelFor(chunks, [&](int c) {
+                auto [lo, hi] = chunkRange(V, chunks, c);
+                vector<Edge> local;
+                for (long long v = lo; v < hi; v++) {
+                    uint64_t key = best[v].load(memory_order_relaxed);
+                    if (key == NONE) continue;
+                    best[v].store(NONE, memory_order_relaxed);
+                    const Edge &e = edges[key & 0xFFFFFFFFu];
+                    if (sets.unite(e.u, e.v)) local.push_back(e);
+                }
+                if (!local.empty()) {
+                    joined = true;
+                    lock_guard<mutex> lock(treeMtx);
+                    tree.insert(tree.end(), local.begin(), local.end());
+                }
+            });
+            if (!joined) break;
+            // 3. drop edges that no longer cross components: compact each
+            // chunk in place, then concatenate the surviving prefixes
+            vector<long long> keep(chunks + 1, 0);
+            pool.parallelFor(chunks, [&](int c) {
+                auto [lo, hi] = chunkRange(m, chunks, c);
+                long long out = lo;
+                for (long long i = lo; i < hi; i++)
+                    if (sets.find(edges[i].u) != sets.find(edges[i].v)) edges[out++] = edges[i];
+                keep[c + 1] = out - lo;
+            });
+            vector<long long> from(chunks);
+            for (int c = 0; c < chunks; c++) {
+                from[c] = chunkRange(m, chunks, c).first;
+                keep[c + 1] += keep[c];
+            }
+            kept.resize(keep[chunks]);
+            pool.parallelFor(chunks, [&](int c) {
+                copy(edges.begin() + from[c], edges.begin() + from[c] + (keep[c + 1] - keep[c]),
+                     kept.begin() + keep[c]);
+            });
+            edges.swap(kept);
+        }
+        return tree;
+    }
+
+    // Array-based Prim in O(V^2 + E): no heap, one linear scan per step for
+    // the closest vertex outside the tree. That beats Kruskal's sort once
+    // E approaches V^2. Disconnected graphs give a spanning forest.
+    vector<Edge> primDense() const {
+        vector<int> key(V, 0), from(V, -1); // from == -1: not reached yet
+        vector<char> inTree(V, 0);
+        vector<Edge> tree;
+        tree.reserve(V > 0 ? V - 1 : 0);
+        for (int step = 0; step < V; step++) {
+            // closest reached vertex; an unreached one only starts a new tree
+            int u = -1;
+            for (int v = 0; v < V; v++) {
+                if (inTree[v]) continue;
+                if (u == -1 || (from[v] != -1 && (from[u] == -1 || key[v] < key[u]))) u = v;
+            }
+            inTree[u] = 1;
+            if (from[u] != -1) tree.push_back({min(u, from[u]), max(u, from[u]), key[u]});
+            for (auto &p : adj[u]) {
+                if (!inTree[p.first] && (from[p.first] == -1 || p.second < key[p.first])) {
+                    key[p.first] = p.second;
+                    from[p.first] = u;
+                }
+            }
+        }
+        return tree;
+    }
+
+    // run on the CSR copy when it is current, otherwise on the adjacency list
+    vector<int> distancesFrom(int src, bool useCsr = true) const {
+        if (useCsr && frozen) return shortestDistances(csr, src);
+        return shortestDistances(AdjacencyView{adj}, src);
+    }
+
+    static constexpr int LANDMARK_COUNT = 16;
+
+    ShortestPath pathBetween(int src, int dst, bool useCsr = true,
+                             RouteMethod method = RouteMethod::Dijkstra) {
+        if (useCsr && frozen) return route(csr, src, dst, method);
+        return route(AdjacencyView{adj}, src, dst, method);
+    }
+
+    template <typename Layout>
+    ShortestPath route(const Layout &g, int src, int dst, RouteMethod method) {
+        switch (method) {
+            case RouteMethod::Bidirectional: return bidirectionalPath(g, src, dst, search, reverseSearch);
+            case RouteMethod::Landmarks: return landmarkPath(g, src, dst);
+            default: return shortestPath(g, src, dst, search);
+        }
+    }
+
+    // precomputes the ALT tables now rather than on the first A* query
+    void prepareLandmarks() {
+        if (landmarksReady) return;
+        if (frozen) buildLandmarks(csr, LANDMARK_COUNT);
+        else buildLandmarks(AdjacencyView{adj}, LANDMARK_COUNT);
+    }
+
+    // Independent Dijkstra searches, one source at a time per worker. Each
+    // worker keeps one SearchSpace for all its sources, so after the first
+    // search it only resets the vertices it touched.
+    template <typename Layout>
+    static void multiSource(const Layout &g, DistanceMatrix &m, ThreadPool &pool) {
+        int workers = (int)min<size_t>(pool.size(), max<size_t>(1, m.sources.size()));
+        vector<SearchSpace> spaces(workers);
+        atomic<size_t> next{0};
+        pool.parallelFor(workers, [&](int t) {
+            SearchSpace &s = spaces[t];
+            for (size_t r; (r = next++) < m.sources.size();) {
+                int *out = m.row((int)r);
+                int src = m.sources[r];
+                if (src < 0 || src >= m.columns) {
+                    fill(out, out + m.columns, INF);
+                    continue;
+                }
+                settleAll(g, src, s);
+                for (int v = 0; v < m.columns; v++) out[v] = (int)min<long long>(s.dist[v], INF);
+            }
+        });
+    }
+
+    // Blocked Floyd-Warshall over 64x64 tiles: for each diagonal tile k,
+    // close it, then its row and column tiles, then every other tile, with
+    // the last two phases spread over the pool. Each inner loop is a
+    // contiguous, vectorisable min over one tile row. Cells never exceed
+    // INF: edge weights are clamped on the way in and a relaxation only
+    // lowers a cell, so d[i][k] + d[k][j] < 2 * INF cannot overflow the
+    // SSE2 lanes. The scalar tail sums in long long all the same.
+    static constexpr int FW_BLOCK = 64;
+
+    static void relaxTile(DistanceMatrix &m, int ib, int jb, int kb) {
+        int n = m.columns;
+        int iEnd = min(ib + FW_BLOCK, n), jEnd = min(jb + FW_BLOCK, n), kEnd = min(kb + FW_BLOCK, n);
+        for (int k = kb; k < kEnd; k++) {
+            const int *rowK = m.row(k);
+            for (int i = ib; i < iEnd; i++) {
+                int *rowI = m.row(i);
+                int dik = rowI[k];
+                if (dik >= INF) continue;
+                int j = jb;
+#ifdef __SSE2__
+                // SSE2 has no 32-bit min, so take it with a compare and blend
+                __m128i add = _mm_set1_epi32(dik);
+                for (; j + 4 <= jEnd; j += 4) {
+                    __m128i cur = _mm_loadu_si128((const __m128i*)(rowI + j));
+                    __m128i via = _mm_add_epi32(add, _mm_loadu_si128((const __m128i*)(rowK + j)));
+                    __m128i shorter = _mm_cmplt_epi32(via, cur);
+                    _mm_storeu_si128((__m128i*)(rowI + j),
+                                     _mm_or_si128(_mm_and_si128(shorter, via), _mm_andnot_si128(shorter, cur)));
+                }
+#endif
+                for (; j < jEnd; j++) {
+                    long long via = (long long)dik + rowK[j];
+                    if (via < rowI[j]) rowI[j] = (int)via;
+                }
+            }
+        }
+    }
+
+    void floydWarshall(DistanceMatrix &m, ThreadPool &pool) const {
+        int n = V;
+        fill(m.dist.begin(), m.dist.end(), INF);
+        for (int u = 0; u < n; u++) {
+            m.row(u)[u] = 0;
+            for (auto &p : adj[u]) m.row(u)[p.first] = min(m.row(u)[p.first], min(p.second, INF));
+        }
+        int tiles = (n + FW_BLOCK - 1) / FW_BLOCK;
+        for (int kt = 0; kt < tiles; kt++) {
+            int kb = kt * FW_BLOCK;
+            relaxTile(m, kb, kb, kb);
+            pool.parallelFor(2 * tiles, [&](int t) {
+                int other = (t % tiles) * FW_BLOCK;
+                if (other == kb) return;
+                if (t < tiles) relaxTile(m, kb, other, kb); // row of the pivot tile
+                else relaxTile(m, other, kb, kb);           // column of the pivot tile
+            });
+            pool.parallelFor(tiles, [&](int it) {
+                int ib = it * FW_BLOCK;
+                if (ib == kb) return;
+                for (int jt = 0; jt < tiles; jt++) {
+                    if (jt != kt) relaxTile(m, ib, jt * FW_BLOCK, kb);
+                }
+            });
+        }
+    }
+
+    // Distances from each source to every building. Auto picks
+    // Floyd-Warshall for all-pairs on small dense graphs, where its O(V^3)
+    // tight loops beat V heap-driven searches, and parallel Dijkstra
+    // otherwise.
+    DistanceMatrix distanceMatrix(const vector<int> &sources, ThreadPool &pool,
+                                  MatrixMethod method = MatrixMethod::Auto) const {
+        DistanceMatrix m;
+        m.sources = sources;
+        m.columns = V;
+        m.dist.assign(sources.size() * (size_t)V, INF);
+        bool allPairs = (int)sources.size() == V;
+        for (int i = 0; allPairs && i < V; i++) allPairs = sources[i] == i;
+        long long arcs = 0;
+        for (auto &list : adj) arcs += (long long)list.size();
+        bool dense = V <= 2048 && arcs * 8 >= (long long)V * V;
+        if (allPairs && (method == MatrixMethod::FloydWarshall || (method == MatrixMethod::Auto && dense))) {
+            floydWarshall(m, pool);
+        } else if (frozen) {
+            multiSource(csr, m, pool);
+        } else {
+            multiSource(AdjacencyView{adj}, m, pool);
+        }
+        return m;
+    }
+
+    vector<Edge> mstEdges(bool useCsr = true) const {
+        if (useCsr && frozen) return minimumSpanningTree(csr);
+        return minimumSpanningTree(AdjacencyView{adj});
+    }
+
+    void dijkstra(int src) {
+        const vector<long long> &dist = cachedDistances(src);
+        if (dist.empty()) {
+            cout << "Invalid building index.\n";
+            return;
+        }
+
+        cout << "Shortest distances from building " << src << ":\n";
+        for (int i = 0; i < V; i++) {
+            cout << "To " << i << " (" << buildingNames[i] << "): ";
+            if (dist[i] == SearchSpace::INF) cout << "INF\n";
+            else cout << dist[i] << "\n";
+        }
+    }
+
+    void printPath(int src, int dst) {
+        printRoute(pathBetween(src, dst, true, RouteMethod::Landmarks), src, dst);
+    }
+
+    void printRoute(const ShortestPath &p, int src, int dst) {
+        if (p.path.empty()) {
+            cout << "No path from building " << src << " to " << dst << ".\n";
+            return;
+        }
+        cout << "Shortest distance: " << p.distance << "\nPath: ";
+        for (size_t i = 0; i < p.path.size(); i++) {
+            if (i) cout << " -> ";
+            cout << p.path[i] << " (" << buildingNames[p.path[i]] << ")";
+        }
+        cout << "\n";
+    }
+
+    // lightest edge between u and v, or INF
+    int edgeWeight(int u, int v) const {
+        int best = INF;
+        for (auto &p : adj[u])
+            if (p.first == v) best = min(best, p.second);
+        return best;
+    }
+
+    void kruskalMST() {
+        printMST("Kruskal", kruskalFast());
+    }
+
+    void primMST() {
+        printMST("Prim", primDense());
+    }
+
+    void boruvkaMST(ThreadPool &pool) {
+        vector<Edge> tree = boruvkaParallel(pool);
+        sort(tree.begin(), tree.end(), [](const Edge &a, const Edge &b) { return a.w < b.w; });
+        printMST("Boruvka", tree);
+    }
+
+    void printMST(const string &label, const vector<Edge> &tree) {
+        long long mstCost = 0;
+        cout << label << " MST edges (for utility layout):\n";
+        for (auto &e : tree) {
+            mstCost += e.w;
+            cout << e.u << " (" << buildingNames[e.u] << ") - "
+                 << e.v << " (" << buildingNames[e.v] << "), cost=" << e.w << "\n";
+        }
+        cout << "Total cable cost (MST weight): " << mstCost << "\n";
+    }
+};
+
+// ===================== Contraction Hierarchies =====================
+// Preprocessing contracts vertices one at a time, least important first.
+// Removing v adds a shortcut u-w of weight d(u,v) + d(v,w) for each pair of
+// its remaining neighbours, unless a bounded witness search finds a path
+// between them that is no longer. The order comes from a lazy priority
+// queue keyed on edge difference plus contracted-neighbour count; a vertex
+// is re-scored only when it reaches the front, which keeps preprocessing
+// to about one witness pass per vertex plus requeues. A query is then a
+// bidirectional Dijkstra that only climbs to higher-ranked vertices, so it
+// settles a few hundred vertices even on large graphs.
+// The graph is undirected, so one upward arc list serves both directions.
+// Shortcut weights are 64-bit: stacked shortcuts sum many edge weights and
+// would overflow an int on long paths.
+
+class ContractionHierarchy {
+    struct Arc {
+        int to;
+        long long w;
+        int via; // middle vertex of a shortcut, -1 for an original edge
+    };
+
+    // witness searches give up after this many settled vertices; scoring a
+    // vertex for the order only needs an estimate, so it uses the small one
+    static constexpr int WITNESS_LIMIT_CONTRACT = 500;
+    static constexpr int WITNESS_LIMIT_ESTIMATE = 40;
+    static constexpr uint32_t FILE_MAGIC = 0x33484343; // "CCH3"
+
+    struct FileHeader {
+        uint32_t magic;
+        int32_t vertices;
+        int32_t arcs;
+        int32_t shortcuts;
+        uint64_t fingerprint;     // graphFingerprint of the graph it was built from
+        uint64_t payloadChecksum; // rank, offsets, targets, weights, vias
+        uint64_t headerChecksum;  // over every field above
+    };
+
+    // upward graph: arcs from each vertex to higher-ranked neighbours
+    vector<int> rank;
+    vector<int> offsets;
+    vector<int> targets;
+    vector<long long> weights;
+    vector<int> vias;
+    int shortcutCount = 0;
+    uint64_t fingerprint = 0;
+
+    SearchSpace forward, backward;
+
+    // Dijkstra from u over the remaining graph, skipping `skip`, until every
+    // target is settled, every key exceeds maxDist or the settle limit is hit
+    static void witnessSearch(const vector<vector<Arc>> &graph, int u, int skip,
+                              const vector<int> &targets, long long maxDist,
+                              int settleLimit, SearchSpace &s) {
+        s.prepare((int)graph.size());
+        s.reach(u, 0, -1);
+        int settled = 0;
+        size_t targetsLeft = targets.size();
+        while (!s.heap.empty() && s.heap.topKey() <= maxDist && settled++ < settleLimit) {
+            int x = s.heap.popMin();
+            if (find(targets.begin(), targets.end(), x) != targets.end() && --targetsLeft == 0) break;
+            long long dx = s.dist[x];
+            for (const Arc &a : graph[x]) {
+                if (a.to != skip && dx + a.w < s.dist[a.to]) s.reach(a.to, dx + a.w, x);
+            }
+        }
+    }
+
+    struct Shortcut { int u, w; long long weight; };
+
+    // shortcuts needed if v were contracted now
+    static void findShortcuts(const vector<vector<Arc>> &graph, int v, int settleLimit,
+                              SearchSpace &s, vector<Shortcut> &out) {
+        out.clear();
+        const vector<Arc> &arcs = graph[v];
+        vector<int> targets;
+        for (size_t i = 0; i + 1 < arcs.size(); i++) {
+            long long maxDist = 0;
+            targets.clear();
+            for (size_t j = i + 1; j < arcs.size(); j++) {
+                maxDist = max(maxDist, arcs[j].w);
+                targets.push_back(arcs[j].to);
+            }
+            maxDist += arcs[i].w;
+            witnessSearch(graph, arcs[i].to, v, targets, maxDist, settleLimit, s);
+            for (size_t j = i + 1; j < arcs.size(); j++) {
+                if (arcs[j].to == arcs[i].to) continue;
+                long long viaV = arcs[i].w + arcs[j].w;
+                if (s.dist[arcs[j].to] > viaV) out.push_back({arcs[i].to, arcs[j].to, viaV});
+            }
+        }
+    }
+
+    static void addOrImprove(vector<Arc> &arcs, int to, long long w, int via) {
+        for (Arc &a : arcs) {
+            if (a.to == to) {
+                if (w < a.w) {
+                    a.w = w;
+                    a.via = via;
+                }
+                return;
+            }
+        }
+        arcs.push_back({to, w, via});
+    }
+
+    // weight and middle vertex of the upward arc between a and b
+    const long long* arcBetween(int a, int b, int &via) const {
+        if (rank[a] > rank[b]) swap(a, b);
+        for (int i = offsets[a]; i < offsets[a + 1]; i++) {
+            if (targets[i] == b) {
+                via = vias[i];
+                return &weights[i];
+            }
+        }
+        return nullptr;
     }
 
-    void setBuildingName(int idx, const string &name) {
-        if (idx >= 0 && idx < V) buildingNames[idx] = name;
+    void unpack(int a, int b, vector<int> &path) const {
+        int via = -1;
+        arcBetween(a, b, via);
+        if (via == -1) {
+            path.push_back(b);
+            return;
+        }
+        unpack(a, via, path);
+        unpack(via, b, path);
     }
 
-    void addEdge(int u, int v, int w) {
-        if (u < 0 || v < 0 || u >= V || v >= V) return;
-        adj[u].push_back({v, w});
-        adj[v].push_back({u, w});
+    // one step of the upward search; returns false once this side is done
+    bool step(SearchSpace &s, const SearchSpace &other, long long &best, int &meet) {
+        if (s.heap.empty() || s.heap.topKey() >= best) return false;
+        int u = s.heap.popMin();
+        long long du = s.dist[u];
+        if (other.dist[u] != SearchSpace::INF && du + other.dist[u] < best) {
+            best = du + other.dist[u];
+            meet = u;
+        }
+        // stall-on-demand: a higher vertex already offers a shorter way to u,
+        // so nothing found through u can be on a shortest path
+        for (int i = offsets[u]; i < offsets[u + 1]; i++)
+            if (s.dist[targets[i]] + weights[i] < du) return true;
+        for (int i = offsets[u]; i < offsets[u + 1]; i++) {
+            int v = targets[i];
+            if (du + weights[i] < s.dist[v]) s.reach(v, du + weights[i], u);
+        }
+        return true;
     }
 
-    void printGraph() {
-        for (int i = 0; i < V; i++) {
-            cout << "Building " << i << " (" << buildingNames[i] << ") -> ";
-            for (auto &p : adj[i]) {
-                cout << "[" << p.first << " (w=" << p.second << ")] ";
+    // Only a hierarchy whose arrays pass these checks is safe to query: every
+    // arc leads upward to a real vertex and every shortcut's middle vertex
+    // ranks below both ends, so unpacking always terminates. A shortcut
+    // spans at most n - 1 edges, which bounds its weight and keeps query
+    // sums well inside long long
+    bool wellFormed() const {
+        int n = vertexCount();
+        long long maxWeight = (long long)max(n - 1, 1) * INT_MAX;
+        vector<char> seen(n, 0);
+        for (int r : rank) {
+            if (r < 0 || r >= n || seen[r]) return false;
+            seen[r] = 1;
+        }
+        if (offsets[0] != 0 || offsets[n] != (int)targets.size()) return false;
+        for (int u = 0; u < n; u++)
+            if (offsets[u] > offsets[u + 1]) return false;
+        for (int u = 0; u < n; u++) {
+            for (int i = offsets[u]; i < offsets[u + 1]; i++) {
+                int v = targets[i], via = vias[i];
+                if (v < 0 || v >= n || rank[v] <= rank[u] || weights[i] < 0 || weights[i] > maxWeight) return false;
+                if (via != -1 && (via < 0 || via >= n || rank[via] >= rank[u])) return false;
             }
-            cout << "\n";
         }
+        return true;
     }
 
-    void dijkstra(int src) {
-        const int INF = 1e9;
-        vector<int> dist(V, INF);
-        dist[src] = 0;
+public:
+    int vertexCount() const { return (int)rank.size(); }
+    int shortcuts() const { return shortcutCount; }
+    long long arcCount() const { return (long long)targets.size(); }
+
+    // Vertex count, arc count and every arc in neighbour order, hashed; a
+    // saved hierarchy is only valid for a graph with the same fingerprint
+    template <typename Layout>
+    static uint64_t graphFingerprint(const Layout &g) {
+        int n = g.vertexCount();
+        vector<int> flat{n};
+        flat.reserve((size_t)n + 1);
+        for (int u = 0; u < n; u++) {
+            size_t degreeAt = flat.size();
+            flat.push_back(0);
+            g.forEachNeighbour(u, [&](int v, int w) {
+                flat.push_back(v);
+                flat.push_back(w);
+                flat[degreeAt]++;
+            });
+        }
+        return graphChecksum(flat.data(), flat.size() * sizeof(int));
+    }
+
+    template <typename Layout>
+    bool builtFor(const Layout &g) const {
+        return vertexCount() == g.vertexCount() && fingerprint == graphFingerprint(g);
+    }
+
+    template <typename Layout>
+    void build(const Layout &g) {
+        int n = g.vertexCount();
+        fingerprint = graphFingerprint(g);
+        vector<vector<Arc>> graph(n);
+        for (int u = 0; u < n; u++) {
+            g.forEachNeighbour(u, [&](int v, int w) {
+                if (v != u) addOrImprove(graph[u], v, w, -1);
+            });
+        }
+
+        SearchSpace witness;
+        vector<Shortcut> found;
+        vector<int> deletedNeighbours(n, 0), priority(n);
+        auto evaluate = [&](int v) {
+            findShortcuts(graph, v, WITNESS_LIMIT_ESTIMATE, witness, found);
+            return (int)found.size() - (int)graph[v].size() + deletedNeighbours[v];
+        };
         using P = pair<int,int>;
-        priority_queue<P, vector<P>, greater<P>> pq;
-        pq.push({0, src});
+        priority_queue<P, vector<P>, greater<P>> order;
+        for (int v = 0; v < n; v++) {
+            priority[v] = evaluate(v);
+            order.push({priority[v], v});
+        }
 
-        while (!pq.empty()) {
-            auto [d, u] = pq.top(); pq.pop();
-            if (d != dist[u]) continue;
-            for (auto &edge : adj[u]) {
-                int v = edge.first, w = edge.second;
-                if (dist[u] + w < dist[v]) {
-                    dist[v] = dist[u] + w;
-                    pq.push({dist[v], v});
+        rank.assign(n, -1);
+        vector<vector<Arc>> upward(n);
+        shortcutCount = 0;
+        int next = 0;
+        while (!order.empty()) {
+            auto [p, v] = order.top(); order.pop();
+            if (rank[v] != -1 || p != priority[v]) continue;
+            // lazy update: re-score v, and requeue it if it is no longer the minimum
+            priority[v] = evaluate(v);
+            if (!order.empty() && priority[v] > order.top().first) {
+                order.push({priority[v], v});
+                continue;
+            }
+            rank[v] = next++;
+            findShortcuts(graph, v, WITNESS_LIMIT_CONTRACT, witness, found);
+            for (const Shortcut &sc : found) {
+                addOrImprove(graph[sc.u], sc.w, sc.weight, v);
+                addOrImprove(graph[sc.w], sc.u, sc.weight, v);
+                shortcutCount++;
+            }
+            for (const Arc &a : graph[v]) {
+                vector<Arc> &back = graph[a.to];
+                for (size_t i = 0; i < back.size(); i++) {
+                    if (back[i].to == v) {
+                        back[i] = back.back();
+                        back.pop_back();
+                        break;
+                    }
                 }
+                deletedNeighbours[a.to]++;
             }
+            upward[v] = std::move(graph[v]);
+            vector<Arc>().swap(graph[v]);
         }
 
-        cout << "Shortest distances from building " << src << ":\n";
-        for (int i = 0; i < V; i++) {
-            cout << "To " << i << " (" << buildingNames[i] << "): ";
-            if (dist[i] == INF) cout << "INF\n";
-            else cout << dist[i] << "\n";
+        offsets.assign(n + 1, 0);
+        for (int v = 0; v < n; v++) offsets[v + 1] = offsets[v] + (int)upward[v].size();
+        targets.resize(offsets[n]);
+        weights.resize(offsets[n]);
+        vias.resize(offsets[n]);
+        for (int v = 0; v < n; v++) {
+            int i = offsets[v];
+            for (const Arc &a : upward[v]) {
+                targets[i] = a.to;
+                weights[i] = a.w;
+                vias[i++] = a.via;
+            }
         }
     }
 
-    struct Edge { int u, v, w; };
-
-    void kruskalMST() {
-        vector<Edge> edges;
-        for (int u = 0; u < V; u++) {
-            for (auto &p : adj[u]) {
-                int v = p.first, w = p.second;
-                if (u < v) edges.push_back({u, v, w});
-            }
+    ShortestPath query(int src, int dst) {
+        int n = vertexCount();
+        if (src < 0 || dst < 0 || src >= n || dst >= n) return {SearchSpace::INF, {}, 0};
+        forward.prepare(n);
+        backward.prepare(n);
+        forward.reach(src, 0, -1);
+        backward.reach(dst, 0, -1);
+        long long best = SearchSpace::INF;
+        int meet = -1;
+        bool fwActive = true, bwActive = true;
+        while (fwActive || bwActive) {
+            if (fwActive) fwActive = step(forward, backward, best, meet);
+            if (bwActive) bwActive = step(backward, forward, best, meet);
         }
-        sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {
-            return a.w < b.w;
-        });
+        size_t explored = forward.touched.size() + backward.touched.size();
+        if (meet == -1) return {SearchSpace::INF, {}, explored};
 
-        vector<int> parent(V), rankV(V,0);
-        iota(parent.begin(), parent.end(), 0);
+        vector<int> up = forward.pathTo(meet), path{src};
+        for (size_t i = 1; i < up.size(); i++) unpack(up[i - 1], up[i], path);
+        for (int v = meet; backward.pred[v] != -1; v = backward.pred[v]) unpack(v, backward.pred[v], path);
+        return {best, path, explored};
+    }
 
-        function<int(int)> findSet = [&](int x) {
-            if (parent[x] == x) return x;
-            return parent[x] = findSet(parent[x]);
-        };
+    // bytes of the rank, offset, target and via arrays plus the 64-bit weights
+    static uint64_t payloadBytes(uint64_t vertices, uint64_t arcs) {
+        return (2 * vertices + 1 + 2 * arcs) * sizeof(int) + arcs * sizeof(long long);
+    }
 
-        auto unionSet = [&](int a, int b) {
-            a = findSet(a);
-            b = findSet(b);
-            if (a != b) {
-                if (rankV[a] < rankV[b]) swap(a,b);
-                parent[b] = a;
-                if (rankV[a] == rankV[b]) rankV[a]++;
-                return true;
-            }
+    // Binary layout: a header with the counts, the graph fingerprint and
+    // checksums, then the rank, offset, target, via and weight arrays
+    // exactly as held in memory
+    bool save(const string &path) const {
+        string payload;
+        payload.reserve(payloadBytes(rank.size(), targets.size()));
+        for (const vector<int> *a : {&rank, &offsets, &targets, &vias})
+            payload.append((const char*)a->data(), a->size() * sizeof(int));
+        payload.append((const char*)weights.data(), weights.size() * sizeof(long long));
+        FileHeader h{FILE_MAGIC, vertexCount(), (int32_t)targets.size(), shortcutCount, fingerprint,
+                     graphChecksum(payload.data(), payload.size()), 0};
+        h.headerChecksum = graphChecksum(&h, offsetof(FileHeader, headerChecksum));
+        ofstream out(path, ios::binary);
+        if (!out) return false;
+        out.write((const char*)&h, sizeof h);
+        out.write(payload.data(), (streamsize)payload.size());
+        return (bool)out;
+    }
+
+    // Sizes are checked against the file length before anything is
+    // allocated, then the checksums and structure; on failure the current
+    // hierarchy is left as it was
+    bool load(const string &path) {
+        ifstream in(path, ios::binary | ios::ate);
+        if (!in) return false;
+        uint64_t fileSize = (uint64_t)in.tellg();
+        FileHeader h{};
+        in.seekg(0);
+        if (fileSize < sizeof h || !in.read((char*)&h, sizeof h)) return false;
+        if (h.magic != FILE_MAGIC || h.headerChecksum != graphChecksum(&h, offsetof(FileHeader, headerChecksum)))
             return false;
+        if (h.vertices < 0 || h.arcs < 0 || h.shortcuts < 0) return false;
+        uint64_t bytes = payloadBytes(h.vertices, h.arcs);
+        if (fileSize != sizeof h + bytes) return false;
+
+        string payload(bytes, '\0');
+        if (!in.read(&payload[0], (streamsize)bytes)) return false;
+        if (graphChecksum(payload.data(), bytes) != h.payloadChecksum) return false;
+
+        ContractionHierarchy loaded;
+        const char *p = payload.data();
+        auto take = [&p](auto &a, size_t count) {
+            a.resize(count);
+            if (count) memcpy(a.data(), p, count * sizeof(a[0]));
+            p += count * sizeof(a[0]);
         };
+        take(loaded.rank, h.vertices);
+        take(loaded.offsets, (size_t)h.vertices + 1);
+        take(loaded.targets, h.arcs);
+        take(loaded.vias, h.arcs);
+        take(loaded.weights, h.arcs);
+        if (!loaded.wellFormed()) return false;
+        rank = std::move(loaded.rank);
+        offsets = std::move(loaded.offsets);
+        targets = std::move(loaded.targets);
+        weights = std::move(loaded.weights);
+        vias = std::move(loaded.vias);
+        shortcutCount = h.shortcuts;
+        fingerprint = h.fingerprint;
+        return true;
+    }
+};
 
-        int mstCost = 0;
-        cout << "Kruskal MST edges (for utility layout):\n";
-        for (auto &e : edges) {
-            if (unionSet(e.u, e.v)) {
-                mstCost += e.w;
-                cout << e.u << " (" << buildingNames[e.u] << ") - "
-                     << e.v << " (" << buildingNames[e.v] << "), cost=" << e.w << "\n";
-            }
+// ===================== Graph Layout Benchmark =====================
+
+// Road-like test graph: vertices on a square grid, each joined to its right
+// and lower neighbour, then random short links to cells at most 3 steps
+// away until E edges exist. Nearby IDs stay nearby in space, as they do in
+// real road-network orderings.
+void makeRoadGraph(CampusGraph &g, int V, long long E, unsigned seed) {
+    g.reset(V);
+    int side = max(1, (int)ceil(sqrt((double)V)));
+    mt19937 rng(seed);
+    uniform_int_distribution<int> weight(1, 100), step(-3, 3), pick(0, V - 1);
+    long long added = 0;
+    for (int u = 0; u < V && added < E; u++) {
+        if ((u + 1) % side != 0 && u + 1 < V) { g.addEdge(u, u + 1, weight(rng)); added++; }
+        if (u + side < V && added < E) { g.addEdge(u, u + side, weight(rng)); added++; }
+    }
+    while (added < E) {
+        int u = pick(rng);
+        int v = u + step(rng) * side + step(rng);
+        if (v == u || v < 0 || v >= V) continue;
+        g.addEdge(u, v, weight(rng));
+        added++;
+    }
+}
+
+void benchmarkGraphLayouts(int V, long long E) {
+    using Clock = chrono::steady_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return chrono::duration<double, milli>(b - a).count();
+    };
+    CampusGraph g;
+    auto t0 = Clock::now();
+    makeRoadGraph(g, V, E, 2024);
+    auto t1 = Clock::now();
+    g.freeze();
+    auto t2 = Clock::now();
+    cout << "Vertices: " << V << ", edges: " << E << "\n";
+    cout << "Build adjacency list: " << ms(t0, t1) << " ms, freeze to CSR: " << ms(t1, t2) << " ms\n";
+
+    const int sources = 3;
+    double listMs = 0, csrMs = 0;
+    bool same = true;
+    mt19937 rng(7);
+    for (int i = 0; i < sources; i++) {
+        int src = (int)(rng() % V);
+        auto a = Clock::now();
+        vector<int> d1 = g.distancesFrom(src, false);
+        auto b = Clock::now();
+        vector<int> d2 = g.distancesFrom(src, true);
+        auto c = Clock::now();
+        listMs += ms(a, b);
+        csrMs += ms(b, c);
+        same = same && d1 == d2;
+    }
+    cout << "Dijkstra (avg of " << sources << " sources): adjacency list " << listMs / sources
+         << " ms, CSR " << csrMs / sources << " ms\n";
+
+    // point-to-point with early exit, checked against the full search
+    const int queries = 100;
+    vector<int> full = g.distancesFrom(0);
+    double p2pMs = 0;
+    for (int i = 0; i < queries; i++) {
+        int dst = (int)(rng() % V);
+        auto a = Clock::now();
+        ShortestPath p = g.pathBetween(0, dst);
+        p2pMs += ms(a, Clock::now());
+        long long expect = full[dst] == CampusGraph::INF ? SearchSpace::INF : full[dst];
+        same = same && p.distance == expect;
+    }
+    cout << "Point-to-point (avg of " << queries << " queries, CSR): " << p2pMs / queries << " ms\n";
+
+    auto a = Clock::now();
+    vector<CampusGraph::Edge> m1 = g.mstEdges(false);
+    auto b = Clock::now();
+    vector<CampusGraph::Edge> m2 = g.mstEdges(true);
+    auto c = Clock::now();
+    auto weightOf = [](const vector<CampusGraph::Edge> &t) {
+        long long s = 0;
+        for (auto &e : t) s += e.w;
+        return s;
+    };
+    cout << "Kruskal: adjacency list " << ms(a, b) << " ms, CSR " << ms(b, c) << " ms\n";
+    if (!same || weightOf(m1) != weightOf(m2))
+        cout << "Warning: layouts disagree (MST " << weightOf(m1) << " vs " << weightOf(m2) << ")\n";
+}
+
+// ===================== Routing Query Benchmark =====================
+
+// Random pairs on a road-like graph: plain early-exit Dijkstra against the
+// bidirectional and ALT searches. Every answer is checked against plain
+// Dijkstra, and the first few sources also against the full dijkstra() pass.
+void benchmarkRoutingQueries(int V, long long E, int queries) {
+    using Clock = chrono::steady_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return chrono::duration<double, milli>(b - a).count();
+    };
+    CampusGraph g;
+    makeRoadGraph(g, V, E, 2024);
+    g.freeze();
+    auto t0 = Clock::now();
+    g.prepareLandmarks();
+    auto t1 = Clock::now();
+    cout << "Vertices: " << V << ", edges: " << E << ", landmarks: " << CampusGraph::LANDMARK_COUNT
+         << " (precomputed in " << ms(t0, t1) << " ms)\n";
+
+    const RouteMethod methods[] = {RouteMethod::Dijkstra, RouteMethod::Bidirectional, RouteMethod::Landmarks};
+    const char *labels[] = {"Dijkstra", "Bidirectional", "ALT (A*)"};
+    double totalMs[3] = {};
+    double explored[3] = {};
+    int mismatches = 0;
+    mt19937 rng(99);
+    for (int q = 0; q < queries; q++) {
+        int src = (int)(rng() % V), dst = (int)(rng() % V);
+        long long expect = 0;
+        for (int m = 0; m < 3; m++) {
+            auto a = Clock::now();
+            ShortestPath p = g.pathBetween(src, dst, true, methods[m]);
+            totalMs[m] += ms(a, Clock::now());
+            explored[m] += (double)p.explored;
+            if (m == 0) expect = p.distance;
+            else if (p.distance != expect) mismatches++;
+            long long length = 0; // the returned route must have the returned length
+            for (size_t i = 1; i < p.path.size(); i++) length += g.edgeWeight(p.path[i - 1], p.path[i]);
+            if (!p.path.empty() && length != p.distance) mismatches++;
+        }
+        if (q < 3) {
+            vector<int> full = g.distancesFrom(src);
+            if ((full[dst] == CampusGraph::INF ? SearchSpace::INF : full[dst]) != expect) mismatches++;
         }
-        cout << "Total cable cost (MST weight): " << mstCost << "\n";
     }
-};
+    cout << left << setw(16) << "Method" << setw(14) << "Avg ms" << "Avg explored\n";
+    for (int m = 0; m < 3; m++) {
+        cout << setw(16) << labels[m] << setw(14) << totalMs[m] / queries
+             << (long long)(explored[m] / queries) << "\n";
+    }
+    cout << right;
+    cout << "Speedup vs Dijkstra: bidirectional " << totalMs[0] / totalMs[1]
+         << "x, ALT " << totalMs[0] / totalMs[2] << "x\n";
+    if (mismatches) cout << "Warning: " << mismatches << " answers disagree with Dijkstra\n";
+    else cout << "All " << queries << " answers match Dijkstra.\n";
+}
+
+// ===================== Contraction Hierarchy Benchmark =====================
+
+// Preprocessing, save/load and queries per second against early-exit and
+// full dijkstra; every hierarchy answer is checked against Dijkstra
+void benchmarkContractionHierarchy(int V, long long E, int queries) {
+    using Clock = chrono::steady_clock;
+    auto secs = [](Clock::time_point a, Clock::time_point b) {
+        return chrono::duration<double>(b - a).count();
+    };
+    CampusGraph g;
+    makeRoadGraph(g, V, E, 2024);
+    g.freeze();
+    ContractionHierarchy built, loaded;
+    auto t0 = Clock::now();
+    built.build(g);
+    auto t1 = Clock::now();
+    string file = (filesystem::temp_directory_path() / "campus_ch_bench.bin").string();
+    bool saved = built.save(file);
+    auto t2 = Clock::now();
+    bool reloaded = saved && loaded.load(file);
+    auto t3 = Clock::now();
+    filesystem::remove(file);
+    cout << "Vertices: " << V << ", edges: " << E << "\n";
+    cout << "Preprocessing: " << secs(t0, t1) << " s, " << built.shortcuts() << " shortcuts, "
+         << built.arcCount() << " upward arcs\n";
+    if (!reloaded) {
+        cout << "Warning: could not save/load " << file << "\n";
+        return;
+    }
+    cout << "Save: " << secs(t1, t2) * 1000 << " ms, load: " << secs(t2, t3) * 1000 << " ms\n";
+
+    mt19937 rng(31);
+    vector<pair<int,int>> pairs(queries);
+    for (auto &p : pairs) p = {(int)(rng() % V), (int)(rng() % V)};
+
+    vector<long long> expect(queries);
+    auto a = Clock::now();
+    for (int q = 0; q < queries; q++) expect[q] = g.pathBetween(pairs[q].first, pairs[q].second).distance;
+    auto b = Clock::now();
+    int mismatches = 0;
+    double explored = 0;
+    for (int q = 0; q < queries; q++) {
+        ShortestPath p = loaded.query(pairs[q].first, pairs[q].second);
+        explored += (double)p.explored;
+        if (p.distance != expect[q]) mismatches++;
+    }
+    auto c = Clock::now();
+    int fullRuns = min(queries, 5);
+    for (int q = 0; q < fullRuns; q++) g.distancesFrom(pairs[q].first);
+    auto d = Clock::now();
+
+    double dijkstraQps = queries / secs(a, b), chQps = queries / secs(b, c);
+    ios::fmtflags oldFlags = cout.flags();
+    streamsize oldPrecision = cout.precision();
+    cout << fixed << setprecision(1);
+    cout << "Full dijkstra:          " << fullRuns / secs(c, d) << " queries/s\n";
+    cout << "Early-exit Dijkstra:    " << dijkstraQps << " queries/s\n";
+    cout << "Contraction hierarchy:  " << chQps << " queries/s ("
+         << 1000.0 / chQps << " ms each, " << (long long)(explored / queries) << " vertices explored)\n";
+    cout << "Speedup vs early-exit Dijkstra: " << chQps / dijkstraQps << "x\n";
+    cout.flags(oldFlags);
+    cout.precision(oldPrecision);
+    if (mismatches) cout << "Warning: " << mismatches << " answers disagree with Dijkstra\n";
+    else cout << "All " << queries << " answers match Dijkstra.\n";
+}
+
+// ===================== Distance Matrix Benchmark =====================
+
+// All-pairs table by parallel Dijkstra at 1, 2, 4, ... threads, and by
+// blocked Floyd-Warshall on the same sparse graph and on a dense one; every
+// table is compared against the single-threaded Dijkstra result
+void benchmarkDistanceMatrix(int V, long long E) {
+    using Clock = chrono::steady_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return chrono::duration<double, milli>(b - a).count();
+    };
+    vector<int> sources(V);
+    iota(sources.begin(), sources.end(), 0);
+    int hw = max(1u, thread::hardware_concurrency());
+
+    CampusGraph sparse;
+    makeRoadGraph(sparse, V, E, 2024);
+    sparse.freeze();
+    cout << "Sparse graph: " << V << " vertices, " << E << " edges (" << V << "x" << V << " table)\n";
+    DistanceMatrix reference;
+    double baseMs = 0;
+    for (int threads = 1; threads <= hw; threads *= 2) {
+        ThreadPool pool(threads);
+        auto a = Clock::now();
+        DistanceMatrix m = sparse.distanceMatrix(sources, pool, MatrixMethod::Dijkstra);
+        double t = ms(a, Clock::now());
+        if (threads == 1) {
+            reference = std::move(m);
+            baseMs = t;
+        } else if (m.dist != reference.dist) {
+            cout << "Warning: " << threads << "-thread table differs\n";
+        }
+        cout << "  Dijkstra x" << V << ", " << threads << " thread(s): " << t << " ms ("
+             << baseMs / t << "x)\n";
+    }
+    ThreadPool pool(hw);
+    auto a = Clock::now();
+    DistanceMatrix fw = sparse.distanceMatrix(sources, pool, MatrixMethod::FloydWarshall);
+    cout << "  Blocked Floyd-Warshall, " << hw << " thread(s): " << ms(a, Clock::now()) << " ms\n";
+    if (fw.dist != reference.dist) cout << "Warning: Floyd-Warshall table differs\n";
+
+    // dense: random links between any two buildings, about a quarter of all pairs
+    long long denseEdges = (long long)V * V / 8;
+    CampusGraph dense(V);
+    mt19937 rng(77);
+    uniform_int_distribution<int> pick(0, V - 1), weight(1, 100);
+    for (long long e = 0; e < denseEdges; e++) dense.addEdge(pick(rng), pick(rng), weight(rng));
+    dense.freeze();
+    cout << "Dense graph: " << V << " vertices, " << denseEdges << " edges\n";
+    a = Clock::now();
+    DistanceMatrix d1 = dense.distanceMatrix(sources, pool, MatrixMethod::Dijkstra);
+    auto b = Clock::now();
+    DistanceMatrix d2 = dense.distanceMatrix(sources, pool, MatrixMethod::FloydWarshall);
+    auto c = Clock::now();
+    cout << "  Dijkstra: " << ms(a, b) << " ms, blocked Floyd-Warshall: " << ms(b, c) << " ms\n";
+    if (d1.dist != d2.dist) cout << "Warning: dense tables differ\n";
+}
+
+// ===================== MST Benchmark =====================
+
+long long treeWeight(const vector<CampusGraph::Edge> &tree) {
+    long long sum = 0;
+    for (auto &e : tree) sum += e.w;
+    return sum;
+}
+
+// Reference Kruskal (gather + comparison sort per call) against the cached
+// radix-sorted path, cold and warm, array Prim and parallel Boruvka at
+// 1, 2, 4, ... threads; on a sparse road-like graph and on a dense random one
+void benchmarkSpanningTrees(int V, long long E) {
+    using Clock = chrono::steady_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return chrono::duration<double, milli>(b - a).count();
+    };
+    auto run = [&](CampusGraph &g, bool withPrim) {
+        auto a = Clock::now();
+        long long ref = treeWeight(g.mstEdges(false));
+        auto b = Clock::now();
+        long long cold = treeWeight(g.kruskalFast());
+        auto c = Clock::now();
+        long long warm = treeWeight(g.kruskalFast());
+        auto d = Clock::now();
+        cout << "  Kruskal reference: " << ms(a, b) << " ms, optimised cold: " << ms(b, c)
+             << " ms, warm: " << ms(c, d) << " ms\n";
+        bool same = cold == ref && warm == ref;
+        if (withPrim) {
+            auto e = Clock::now();
+            long long prim = treeWeight(g.primDense());
+            cout << "  Prim (array): " << ms(e, Clock::now()) << " ms\n";
+            same = same && prim == ref;
+        }
+        int hw = max(1u, thread::hardware_concurrency());
+        double single = 0;
+        for (int threads = 1; threads <= 2 * hw; threads *= 2) {
+            ThreadPool pool(threads);
+            auto e = Clock::now();
+            long long boruvka = treeWeight(g.boruvkaParallel(pool));
+            double t = ms(e, Clock::now());
+            if (threads == 1) single = t;
+            cout << "  Parallel Boruvka, " << threads << " thread(s): " << t << " ms ("
+                 << single / t << "x)\n";
+            same = same && boruvka == ref;
+        }
+        if (!same) cout << "Warning: MST weights differ\n";
+        else cout << "  MST weight " << ref << " from every method\n";
+    };
+
+    CampusGraph sparse;
+    makeRoadGraph(sparse, V, E, 2024);
+    cout << "Sparse graph: " << V << " vertices, " << E << " edges\n";
+    run(sparse, V <= 20000);
+
+    int denseV = min(V, 3000);
+    long long denseE = (long long)denseV * denseV / 4;
+    CampusGraph dense(denseV);
+    mt19937 rng(5);
+    uniform_int_distribution<int> pick(0, denseV - 1), weight(1, 1000);
+    for (int u = 1; u < denseV; u++) dense.addEdge(u, pick(rng) % u, weight(rng)); // keep it connected
+    for (long long e = denseV - 1; e < denseE; e++) dense.addEdge(pick(rng), pick(rng), weight(rng));
+    cout << "Dense graph: " << denseV << " vertices, " << denseE << " edges\n";
+    run(dense, true);
+}
+
+// ===================== Dynamic Update Benchmark =====================
+
+// Random closures, reopenings and reweights on a road-like graph with a few
+// sources cached: incremental tree repair against recomputing every cached
+// source from scratch after each edit, then a full cross-check
+void benchmarkDynamicUpdates(int V, long long E, int edits) {
+    using Clock = chrono::steady_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return chrono::duration<double, milli>(b - a).count();
+    };
+    CampusGraph g;
+    makeRoadGraph(g, V, E, 2024);
+    mt19937 rng(17);
+    const int sources = 4;
+    vector<int> src(sources);
+    for (int &s : src) {
+        s = (int)(rng() % V);
+        g.cachedDistances(s);
+    }
+
+    // edits only touch grid edges (u, u+1), so closures can be reopened
+    int side = max(1, (int)ceil(sqrt((double)V)));
+    uniform_int_distribution<int> weight(1, 100);
+    vector<pair<int,int>> closed;
+    double repairMs = 0, rebuildMs = 0;
+    for (int i = 0; i < edits; i++) {
+        int op = (int)(rng() % 3);
+        auto a = Clock::now();
+        if (op == 0 && !closed.empty()) {
+            auto [u, v] = closed.back();
+            closed.pop_back();
+            g.addEdge(u, v, weight(rng));
+        } else {
+            int u = (int)(rng() % (V - 1));
+            if ((u + 1) % side == 0) u--;
+            if (u < 0) continue;
+            if (op == 1 && g.removeEdge(u, u + 1)) closed.push_back({u, u + 1});
+            else g.updateWeight(u, u + 1, weight(rng));
+        }
+        for (int s : src) g.cachedDistances(s);
+        auto b = Clock::now();
+        repairMs += ms(a, b);
+        if (i < 5) { // sample what a full recomputation costs
+            for (int s : src) g.distancesFrom(s, false);
+            rebuildMs += ms(b, Clock::now());
+        }
+    }
+    int sampled = min(edits, 5);
+    cout << "Vertices: " << V << ", edges: " << E << ", cached sources: " << sources << "\n";
+    cout << "Incremental repair: " << repairMs / edits << " ms per edit\n";
+    cout << "Full recomputation: " << rebuildMs / sampled << " ms per edit ("
+         << (rebuildMs / sampled) / (repairMs / edits) << "x slower)\n";
+
+    long long mismatches = 0;
+    for (int s : src) {
+        const vector<long long> &cached = g.cachedDistances(s);
+        vector<int> fresh = g.distancesFrom(s, false);
+        for (int v = 0; v < V; v++) {
+            long long expect = fresh[v] == CampusGraph::INF ? SearchSpace::INF : fresh[v];
+            mismatches += cached[v] != expect;
+        }
+    }
+    if (mismatches) cout << "Warning: " << mismatches << " cached distances are stale\n";
+    else cout << "Cached trees match a fresh dijkstra for every source.\n";
+}
+
+// ===================== Graph File Benchmark =====================
+
+// Edge-list text import against writing and mapping the binary file, then a
+// full dijkstra run straight off the mapping, checked against the original
+void benchmarkGraphFile(int V, long long E, ThreadPool &pool) {
+    using Clock = chrono::steady_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return chrono::duration<double, milli>(b - a).count();
+    };
+    CampusGraph g;
+    makeRoadGraph(g, V, E, 2024);
+    g.freeze();
+    auto dir = filesystem::temp_directory_path();
+    string textFile = (dir / "campus_graph_bench.gr").string();
+    string binFile = (dir / "campus_graph_bench.cgr").string();
+
+    string text = "c road-like benchmark graph\np sp " + to_string(V) + " " + to_string(E) + "\n";
+    for (int u = 0; u < V; u++) {
+        g.forEachNeighbour(u, [&](int v, int w) {
+            if (u >= v) return;
+            text += "a ";
+            text += to_string(u + 1);
+            text += ' ';
+            text += to_string(v + 1);
+            text += ' ';
+            text += to_string(w);
+            text += '\n';
+        });
+    }
+    {
+        ofstream out(textFile, ios::binary);
+        out.write(text.data(), (streamsize)text.size());
+    }
+    size_t textBytes = text.size();
+    string().swap(text);
+
+    CsrGraph imported;
+    EdgeListImportStats stats;
+    auto t0 = Clock::now();
+    bool parsed = loadEdgeList(textFile, pool, imported, stats);
+    auto t1 = Clock::now();
+    bool written = parsed && GraphFile::write(binFile, imported, {});
+    auto t2 = Clock::now();
+    GraphFile file;
+    bool opened = written && file.open(binFile);
+    auto t3 = Clock::now();
+    bool verified = opened && file.verify();
+    auto t4 = Clock::now();
+    filesystem::remove(textFile);
+    if (!verified) {
+        filesystem::remove(binFile);
+        cout << "Warning: graph file round trip failed"
+             << (file.error().empty() ? "" : ": " + file.error()) << "\n";
+        return;
+    }
+    cout << "Vertices: " << V << ", edges: " << stats.edges << "\n";
+    cout << "Edge-list import: " << ms(t0, t1) << " ms (" << textBytes / 1e6 << " MB of text)\n";
+    cout << "Binary write: " << ms(t1, t2) << " ms ("
+         << filesystem::file_size(binFile) / 1e6 << " MB)\n";
+    cout << "Map: " << ms(t2, t3) << " ms, checksum + structure verify: " << ms(t3, t4) << " ms\n";
+
+    int src = V / 2;
+    auto a = Clock::now();
+    vector<int> mappedDist = CampusGraph::shortestDistances(file, src);
+    auto b = Clock::now();
+    vector<int> expect = g.distancesFrom(src);
+    CampusGraph adopted;
+    auto c = Clock::now();
+    adopted.assign(file);
+    auto d = Clock::now();
+    file.close();
+    filesystem::remove(binFile);
+    cout << "Dijkstra straight off the mapping: " << ms(a, b) << " ms\n";
+    cout << "Rebuilding CampusGraph adjacency from the file: " << ms(c, d) << " ms\n";
+    if (mappedDist != expect || adopted.distancesFrom(src) != expect)
+        cout << "Warning: distances from the graph file differ from the original\n";
+    else
+        cout << "Distances from the graph file match the original.\n";
+}
 
 // ===================== Expression Tree for Energy Bill =====================
 
@@ -306,20 +2647,209 @@ struct ExprNode {
     ExprNode(const string &v) : val(v), left(nullptr), right(nullptr) {}
 };
 
+// ===================== Compiled Energy Formula =====================
+// Flat bytecode for a small stack machine, produced by
+// ExpressionTree::compile. Numbers are parsed once into immediates and named
+// leaves (kwh, rate, ...) become variable slots, so evaluation touches no
+// strings. While emitting, operators over two constants are folded and a
+// constant or variable right operand is fused into the operator instead of
+// being pushed. Arithmetic matches evalRec exactly, including x / 0 == 0.
+//
+// evaluateBatch runs the program over blocks of BATCH_BLOCK meters at once:
+// each block is transposed to one column per variable, every instruction is a
+// straight loop over the block (SSE2 when available) and the stack holds
+// columns instead of single values.
+
+class CompiledFormula {
+public:
+    enum class Op : uint8_t { Push, Add, Sub, Mul, Div };
+    enum class Operand : uint8_t { Stack, Const, Var };
+    struct Instr {
+        Op op;
+        Operand kind;
+        int var;      // slot for Operand::Var
+        double value; // immediate for Operand::Const
+    };
+    static constexpr int BATCH_BLOCK = 64;
+
+private:
+    friend class ExpressionTree;
+    vector<Instr> code;
+    vector<string> names;
+    int depth = 0, maxDepth = 0;
+
+    static double combine(Op op, double l, double r) {
+        switch (op) {
+        case Op::Add: return l + r;
+        case Op::Sub: return l - r;
+        case Op::Mul: return l * r;
+        case Op::Div: return r != 0 ? l / r : 0.0;
+        default: return r;
+        }
+    }
+
+    static bool isIdentifier(const string &s) {
+        if (s.empty() || !(isalpha((unsigned char)s[0]) || s[0] == '_')) return false;
+        for (char c : s)
+            if (!isalnum((unsigned char)c) && c != '_') return false;
+        return true;
+    }
+
+    // a number becomes an immediate, a name a variable slot; false otherwise.
+    // The number is tried first so that "inf" and "nan", which stod accepts
+    // and which look like names, stay constants as they are in evalRec.
+    static bool parseNumber(const string &token, double &value) {
+        size_t used = 0;
+        try {
+            value = stod(token, &used);
+        } catch (const exception &) {
+            return false;
+        }
+        return used == token.size();
+    }
+
+    bool pushLeaf(const string &token) {
+        Instr in{Op::Push, Operand::Const, 0, 0.0};
+        if (!parseNumber(token, in.value)) {
+            if (!isIdentifier(token)) return false;
+            in.kind = Operand::Var;
+            in.var = (int)(find(names.begin(), names.end(), token) - names.begin());
+            if (in.var == (int)names.size()) names.push_back(token);
+        }
+        code.push_back(in);
+        maxDepth = max(maxDepth, ++depth);
+        return true;
+    }
+
+    void pushOperator(Op op) {
+        size_t n = code.size();
+        depth--;
+        if (n >= 2 && code[n - 1].op == Op::Push && code[n - 2].op == Op::Push &&
+            code[n - 1].kind == Operand::Const && code[n - 2].kind == Operand::Const) {
+            code[n - 2].value = combine(op, code[n - 2].value, code[n - 1].value);
+            code.pop_back();
+        } else if (code[n - 1].op == Op::Push) {
+            code[n - 1].op = op; // right operand rides along instead of being pushed
+        } else {
+            code.push_back({op, Operand::Stack, 0, 0.0});
+        }
+    }
+
+    // a[i] = a[i] op b[i] across one block
+    static void applyBlock(Op op, double *a, const double *b) {
+        int i = 0;
+#ifdef __SSE2__
+        switch (op) {
+        case Op::Add:
+            for (; i + 2 <= BATCH_BLOCK; i += 2)
+                _mm_storeu_pd(a + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            break;
+        case Op::Sub:
+            for (; i + 2 <= BATCH_BLOCK; i += 2)
+                _mm_storeu_pd(a + i, _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            break;
+        case Op::Mul:
+            for (; i + 2 <= BATCH_BLOCK; i += 2)
+                _mm_storeu_pd(a + i, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            break;
+        case Op::Div: {
+            // divide every lane, then zero the ones whose divisor was 0
+            const __m128d zero = _mm_setzero_pd();
+            for (; i + 2 <= BATCH_BLOCK; i += 2) {
+                __m128d y = _mm_loadu_pd(b + i);
+                _mm_storeu_pd(a + i, _mm_and_pd(_mm_div_pd(_mm_loadu_pd(a + i), y), _mm_cmpneq_pd(y, zero)));
+            }
+            break;
+        }
+        default: break;
+        }
+#endif
+        for (; i < BATCH_BLOCK; i++) a[i] = combine(op, a[i], b[i]);
+    }
+
+public:
+    int variableCount() const { return (int)names.size(); }
+    const vector<string>& variables() const { return names; }
+    size_t instructionCount() const { return code.size(); }
+
+    // values[i] is the value of variables()[i]; 0 when values are missing
+    double evaluate(const vector<double> &values) const {
+        if (code.empty() || values.size() < names.size()) return 0.0;
+        double local[64];
+        vector<double> spill;
+        double *st = local;
+        if (maxDepth > 64) {
+            spill.resize(maxDepth);
+            st = spill.data();
+        }
+        int sp = -1;
+        for (const Instr &in : code) {
+            double x = in.kind == Operand::Const ? in.value : in.kind == Operand::Var ? values[in.var] : 0.0;
+            if (in.op == Op::Push) {
+                st[++sp] = x;
+                continue;
+            }
+            if (in.kind == Operand::Stack) x = st[sp--];
+            st[sp] = combine(in.op, st[sp], x);
+        }
+        return st[0];
+    }
+
+    // rows holds count meters back to back, variableCount() values each;
+    // out[r] is the bill for row r. False when rows is too short.
+    bool evaluateBatch(const vector<double> &rows, size_t count, vector<double> &out) const {
+        size_t vars = names.size();
+        if (rows.size() < count * vars) return false;
+        out.resize(count);
+        if (code.empty()) {
+            fill(out.begin(), out.end(), 0.0);
+            return true;
+        }
+        const size_t B = BATCH_BLOCK;
+        vector<double> columns(vars * B), stack((size_t)maxDepth * B), splat(B);
+        for (size_t base = 0; base < count; base += B) {
+            size_t n = min(B, count - base);
+            const double *block = rows.data() + base * vars;
+            for (size_t v = 0; v < vars; v++) {
+                double *col = &columns[v * B];
+                for (size_t i = 0; i < n; i++) col[i] = block[i * vars + v];
+                fill(col + n, col + B, 0.0); // spare lanes of the last block
+            }
+            int sp = -1;
+            for (const Instr &in : code) {
+                const double *src;
+                if (in.kind == Operand::Var) {
+                    src = &columns[(size_t)in.var * B];
+                } else if (in.kind == Operand::Const) {
+                    fill(splat.begin(), splat.end(), in.value);
+                    src = splat.data();
+                } else {
+                    src = &stack[(size_t)sp-- * B];
+                }
+                if (in.op == Op::Push) copy(src, src + B, &stack[(size_t)++sp * B]);
+                else applyBlock(in.op, &stack[(size_t)sp * B], src);
+            }
+            copy(stack.begin(), stack.begin() + n, out.begin() + base);
+        }
+        return true;
+    }
+};
+
 class ExpressionTree {
     ExprNode *root;
 
-    bool isOperator(const string &s) {
+    bool isOperator(const string &s) const {
         return s == "+" || s == "-" || s == "*" || s == "/";
     }
 
-    double evalRec(ExprNode *node) {
+    double evalRec(ExprNode *node, const unordered_map<string,double> &vars) {
         if (!node) return 0.0;
         if (!isOperator(node->val)) {
-            return stod(node->val);
+            auto it = vars.find(node->val);
+            return it != vars.end() ? it->second : stod(node->val);
         }
-        double l = evalRec(node->left);
-        double r = evalRec(node->right);
+        double l = evalRec(node->left, vars);
+        double r = evalRec(node->right, vars);
         if (node->val == "+") return l + r;
         if (node->val == "-") return l - r;
         if (node->val == "*") return l * r;
@@ -333,18 +2863,35 @@ class ExpressionTree {
         delete node;
     }
 
+    // post-order walk, so the bytecode comes out in postfix order
+    bool emit(const ExprNode *node, CompiledFormula &out) const {
+        if (!isOperator(node->val)) return out.pushLeaf(node->val);
+        if (!emit(node->left, out) || !emit(node->right, out)) return false;
+        const string &op = node->val;
+        using Op = CompiledFormula::Op;
+        out.pushOperator(op == "+" ? Op::Add : op == "-" ? Op::Sub : op == "*" ? Op::Mul : Op::Div);
+        return true;
+    }
+
 public:
     ExpressionTree() : root(nullptr) {}
     ~ExpressionTree() { destroy(root); }
 
-    void buildFromPostfix(const vector<string> &postfix) {
+    // false (and an empty tree) when an operator is short of operands or
+    // more than one value is left over
+    bool buildFromPostfix(const vector<string> &postfix) {
         destroy(root);
         root = nullptr;
         stack<ExprNode*> st;
+        auto discard = [&]() {
+            for (; !st.empty(); st.pop()) destroy(st.top());
+            return false;
+        };
         for (const string &token : postfix) {
             if (!isOperator(token)) {
                 st.push(new ExprNode(token));
             } else {
+                if (st.size() < 2) return discard();
                 ExprNode *r = st.top(); st.pop();
                 ExprNode *l = st.top(); st.pop();
                 ExprNode *op = new ExprNode(token);
@@ -353,22 +2900,103 @@ public:
                 st.push(op);
             }
         }
+        if (st.size() > 1) return discard();
         if (!st.empty()) root = st.top();
+        return true;
     }
 
-    double evaluateExpression() {
+    // named leaves are looked up in vars; anything else must be a number
+    double evaluateExpression(const unordered_map<string,double> &vars = {}) {
         if (!root) return 0.0;
-        return evalRec(root);
+        return evalRec(root, vars);
+    }
+
+    // false when a leaf is neither a number nor a name
+    bool compile(CompiledFormula &out) const {
+        out = CompiledFormula();
+        return !root || emit(root, out);
     }
 };
 
+// ===================== Energy Formula Benchmark =====================
+
+// One tariff over many meters: the tree walk (string compares, stod and a
+// name lookup per leaf) against the compiled bytecode one row at a time and
+// in blocks; all three must agree bit for bit
+void benchmarkEnergyFormula(size_t meters) {
+    using Clock = chrono::steady_clock;
+    auto ns = [](Clock::time_point a, Clock::time_point b, size_t n) {
+        return chrono::duration<double, nano>(b - a).count() / n;
+    };
+    const string tariff = "kwh 0.12 1.05 * * kwh 500 - peak * 0.08 * + standing days 30 / * + 1 tax + * discount -";
+    stringstream ss(tariff);
+    vector<string> tokens;
+    for (string tok; ss >> tok;) tokens.push_back(tok);
+    ExpressionTree tree;
+    CompiledFormula formula;
+    tree.buildFromPostfix(tokens);
+    tree.compile(formula);
+    int vars = formula.variableCount();
+
+    mt19937 rng(7);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    vector<double> rows(meters * vars);
+    for (size_t r = 0; r < meters; r++) {
+        for (int v = 0; v < vars; v++) {
+            const string &name = formula.variables()[v];
+            double x = unit(rng);
+            if (name == "kwh") x *= 2000;
+            else if (name == "days") x = (double)(rng() % 31); // 0 days exercises x / 0
+            else if (name == "standing") x *= 40;
+            rows[r * vars + v] = x;
+        }
+    }
+
+    size_t sampled = min(meters, (size_t)200000); // the tree walk is slow
+    vector<double> byTree(sampled), byRow(meters), byBatch;
+    unordered_map<string,double> env;
+    auto t0 = Clock::now();
+    for (size_t r = 0; r < sampled; r++) {
+        for (int v = 0; v < vars; v++) env[formula.variables()[v]] = rows[r * vars + v];
+        byTree[r] = tree.evaluateExpression(env);
+    }
+    auto t1 = Clock::now();
+    vector<double> values(vars);
+    for (size_t r = 0; r < meters; r++) {
+        copy(rows.begin() + r * vars, rows.begin() + (r + 1) * vars, values.begin());
+        byRow[r] = formula.evaluate(values);
+    }
+    auto t2 = Clock::now();
+    formula.evaluateBatch(rows, meters, byBatch);
+    auto t3 = Clock::now();
+
+    auto same = [](double a, double b) { return a == b || (isnan(a) && isnan(b)); };
+    size_t mismatches = 0;
+    for (size_t r = 0; r < meters; r++) {
+        mismatches += !same(byRow[r], byBatch[r]);
+        if (r < sampled) mismatches += !same(byTree[r], byRow[r]);
+    }
+    cout << "Tariff: " << tariff << "\n";
+    cout << "Meters: " << meters << ", variables: " << vars << ", bytecode: "
+         << formula.instructionCount() << " instructions for " << tokens.size() << " tokens\n";
+    cout << "Tree walk: " << ns(t0, t1, sampled) << " ns per meter\n";
+    cout << "Bytecode, one row at a time: " << ns(t1, t2, meters) << " ns per meter\n";
+    cout << "Bytecode, blocks of " << CompiledFormula::BATCH_BLOCK << ": " << ns(t2, t3, meters)
+         << " ns per meter\n";
+    if (mismatches) cout << "Warning: " << mismatches << " bills disagree\n";
+    else cout << "All evaluators agree on every bill.\n";
+}
+
 // ===================== Campus Navigation and Utility Planner =====================
 
 class CampusPlanner {
     BuildingBST buildingTree;
     BuildingAVL buildingAVL;
     CampusGraph graph;
+    ContractionHierarchy hierarchy;
+    bool hierarchyReady = false; // built from or loaded for the current graph
     ExpressionTree exprTree;
+    ThreadPool pool;
 
 public:
     void addBuildingRecord() {
@@ -402,6 +3030,7 @@ public:
         cout << "Enter number of buildings (vertices): ";
         cin >> V;
         graph.reset(V);
+        hierarchyReady = false;
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
         for (int i = 0; i < V; i++) {
             string name;
@@ -416,8 +3045,9 @@ public:
             int u, v, w;
             cout << "Edge " << i + 1 << " (u v distance): ";
             cin >> u >> v >> w;
-            graph.addEdge(u, v, w);
+            if (!graph.addEdge(u, v, w)) cout << "Skipped: unknown building or negative distance.\n";
         }
+        graph.freeze();
         cout << "Campus graph (adjacency list):\n";
         graph.printGraph();
     }
@@ -429,12 +3059,260 @@ public:
         graph.dijkstra(src);
     }
 
+    void findPathBetween() {
+        int src, dst;
+        cout << "Enter source and destination building indices: ";
+        cin >> src >> dst;
+        graph.printPath(src, dst);
+    }
+
     void planUtilityLayout() {
-        graph.kruskalMST();
+        int ch;
+        cout << "Algorithm: 1.Kruskal  2.Prim (dense graphs)  3.Parallel Boruvka\n";
+        cin >> ch;
+        if (ch == 2) graph.primMST();
+        else if (ch == 3) graph.boruvkaMST(pool);
+        else graph.kruskalMST();
+    }
+
+    void benchmarkMST() {
+        int V;
+        long long E;
+        cout << "Enter vertices and edges (e.g. 1000000 10000000): ";
+        cin >> V >> E;
+        if (V <= 1 || E <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkSpanningTrees(V, E);
+    }
+
+    void benchmarkLayouts() {
+        int V;
+        long long E;
+        cout << "Enter vertices and edges (e.g. 1000000 10000000): ";
+        cin >> V >> E;
+        if (V <= 1 || E <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkGraphLayouts(V, E);
+    }
+
+    void graphFileMenu() {
+        int ch;
+        cout << "1. Save current graph  2. Load graph file  3. Import DIMACS edge list\n";
+        cin >> ch;
+        if (ch < 1 || ch > 3) {
+            cout << "Invalid option.\n";
+            return;
+        }
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        string path;
+        cout << (ch == 3 ? "Enter edge list path: " : "Enter file path: ");
+        getline(cin, path);
+        if (ch == 1) {
+            if (graph.saveBinary(path)) cout << "Graph saved to " << path << ".\n";
+            else cout << "Cannot write " << path << ".\n";
+        } else if (ch == 2) {
+            GraphFile file;
+            auto t0 = chrono::steady_clock::now();
+            if (!file.open(path) || !file.verify()) {
+                cout << "Cannot load " << path << ": " << file.error() << ".\n";
+                return;
+            }
+            auto t1 = chrono::steady_clock::now();
+            graph.assign(file);
+            hierarchyReady = false;
+            cout << "Loaded " << graph.vertexCount() << " buildings and " << file.arcCount() / 2
+                 << " paths (mapped and verified in "
+                 << chrono::duration<double, milli>(t1 - t0).count() << " ms, adjacency built in "
+                 << chrono::duration<double, milli>(chrono::steady_clock::now() - t1).count()
+                 << " ms).\n";
+        } else {
+            string target;
+            cout << "Enter graph file to write: ";
+            getline(cin, target);
+            CsrGraph imported;
+            EdgeListImportStats stats;
+            if (!loadEdgeList(path, pool, imported, stats)) {
+                cout << "Cannot import " << path << ": unreadable or invalid edge list.\n";
+            } else if (!GraphFile::write(target, imported, {})) {
+                cout << "Cannot write " << target << ".\n";
+            } else {
+                cout << "Imported " << stats.edges << " paths between " << imported.vertexCount()
+                     << " buildings into " << target << " (" << stats.malformed
+                     << " malformed lines skipped).\n";
+            }
+        }
+    }
+
+    void benchmarkGraphFiles() {
+        int V;
+        long long E;
+        cout << "Enter vertices and edges (e.g. 4000000 10000000): ";
+        cin >> V >> E;
+        if (V <= 1 || E <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkGraphFile(V, E, pool);
+    }
+
+    void editCampusPaths() {
+        if (graph.vertexCount() == 0) {
+            cout << "Construct the campus graph first.\n";
+            return;
+        }
+        int ch, u, v, w = 0;
+        cout << "1. Add path  2. Close path  3. Change path distance\n";
+        cin >> ch;
+        if (ch < 1 || ch > 3) {
+            cout << "Invalid option.\n";
+            return;
+        }
+        cout << (ch == 2 ? "Enter path (u v): " : "Enter path (u v distance): ");
+        cin >> u >> v;
+        if (ch != 2) cin >> w;
+        if (w < 0) {
+            cout << "Distance cannot be negative.\n";
+            return;
+        }
+        bool ok = true;
+        if (ch == 1) {
+            ok = graph.addEdge(u, v, w);
+        } else if (ch == 2) {
+            ok = graph.removeEdge(u, v);
+        } else {
+            ok = graph.updateWeight(u, v, w);
+        }
+        if (!ok) {
+            cout << "No such path.\n";
+            return;
+        }
+        hierarchyReady = false;
+        cout << "Path updated; " << graph.cachedSourceCount()
+             << " cached shortest-path tree(s) repaired.\n";
+    }
+
+    void benchmarkDynamic() {
+        int V, edits;
+        long long E;
+        cout << "Enter vertices, edges and edit count (e.g. 1000000 2500000 200): ";
+        cin >> V >> E >> edits;
+        if (V <= 1 || E <= 0 || edits <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkDynamicUpdates(V, E, edits);
+    }
+
+    void showDistanceTable() {
+        int V = graph.vertexCount();
+        if (V == 0) {
+            cout << "Construct the campus graph first.\n";
+            return;
+        }
+        vector<int> sources(V);
+        iota(sources.begin(), sources.end(), 0);
+        DistanceMatrix m = graph.distanceMatrix(sources, pool);
+        cout << "Building-to-building distances (rows: from, columns: to):\n";
+        cout << setw(6) << "";
+        for (int j = 0; j < V; j++) cout << setw(8) << j;
+        cout << "\n";
+        for (int i = 0; i < V; i++) {
+            cout << setw(6) << i;
+            for (int j = 0; j < V; j++) {
+                if (m.at(i, j) == CampusGraph::INF) cout << setw(8) << "INF";
+                else cout << setw(8) << m.at(i, j);
+            }
+            cout << "\n";
+        }
+    }
+
+    void benchmarkMatrix() {
+        int V;
+        long long E;
+        cout << "Enter vertices and edges (e.g. 2000 8000): ";
+        cin >> V >> E;
+        if (V <= 1 || E <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkDistanceMatrix(V, E);
+    }
+
+    void contractionHierarchyMenu() {
+        int ch;
+        cout << "1. Build from current graph  2. Save to file  3. Load from file  4. Query path\n";
+        cin >> ch;
+        if (ch == 1) {
+            auto t0 = chrono::steady_clock::now();
+            hierarchy.build(graph);
+            hierarchyReady = true;
+            cout << "Hierarchy built in "
+                 << chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count()
+                 << " ms (" << hierarchy.shortcuts() << " shortcuts).\n";
+        } else if (ch == 2 || ch == 3) {
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            string path;
+            cout << "Enter file path: ";
+            getline(cin, path);
+            if (ch == 2) {
+                if (!hierarchyReady) cout << "Build the hierarchy first.\n";
+                else if (hierarchy.save(path)) cout << "Hierarchy saved to " << path << ".\n";
+                else cout << "Cannot write " << path << ".\n";
+            } else if (!hierarchy.load(path)) {
+                hierarchyReady = false;
+                cout << "Cannot read " << path << ".\n";
+            } else if (!hierarchy.builtFor(graph)) {
+                hierarchyReady = false;
+                cout << "Hierarchy was built for a different graph (" << hierarchy.vertexCount()
+                     << " buildings); rebuild it for the current one.\n";
+            } else {
+                hierarchyReady = true;
+                cout << "Hierarchy loaded.\n";
+            }
+        } else if (ch == 4) {
+            if (!hierarchyReady) {
+                cout << "Build or load the hierarchy first.\n";
+                return;
+            }
+            int src, dst;
+            cout << "Enter source and destination building indices: ";
+            cin >> src >> dst;
+            graph.printRoute(hierarchy.query(src, dst), src, dst);
+        } else {
+            cout << "Invalid option.\n";
+        }
+    }
+
+    void benchmarkHierarchy() {
+        int V, queries;
+        long long E;
+        cout << "Enter vertices, edges and query count (e.g. 100000 250000 1000): ";
+        cin >> V >> E >> queries;
+        if (V <= 1 || E <= 0 || queries <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkContractionHierarchy(V, E, queries);
+    }
+
+    void benchmarkRouting() {
+        int V, queries;
+        long long E;
+        cout << "Enter vertices, edges and query count (e.g. 1000000 2500000 50): ";
+        cin >> V >> E >> queries;
+        if (V <= 1 || E <= 0 || queries <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkRoutingQueries(V, E, queries);
     }
 
     void evaluateEnergyExpression() {
-        cout << "Enter postfix expression tokens separated by space (e.g., 100 2 * 50 +):\n";
+        cout << "Enter postfix expression tokens separated by space (e.g., 100 2 * 50 + or kwh rate * 50 +):\n";
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
         string line;
         getline(cin, line);
@@ -442,9 +3320,28 @@ public:
         vector<string> tokens;
         string tok;
         while (ss >> tok) tokens.push_back(tok);
-        exprTree.buildFromPostfix(tokens);
-        double result = exprTree.evaluateExpression();
-        cout << "Evaluated energy bill: " << result << "\n";
+        CompiledFormula formula;
+        if (!exprTree.buildFromPostfix(tokens) || !exprTree.compile(formula)) {
+            cout << "Malformed expression.\n";
+            return;
+        }
+        vector<double> values(formula.variableCount());
+        for (int i = 0; i < formula.variableCount(); i++) {
+            cout << "Enter value for " << formula.variables()[i] << ": ";
+            cin >> values[i];
+        }
+        cout << "Evaluated energy bill: " << formula.evaluate(values) << "\n";
+    }
+
+    void benchmarkEnergy() {
+        long long meters;
+        cout << "Enter number of meters (e.g. 2000000): ";
+        cin >> meters;
+        if (meters <= 0) {
+            cout << "Invalid size.\n";
+            return;
+        }
+        benchmarkEnergyFormula((size_t)meters);
     }
 };
 
@@ -461,9 +3358,22 @@ int main() {
         cout << "2. List Campus Locations (Tree Traversals)\n";
         cout << "3. Construct Campus Graph & Show\n";
         cout << "4. Find Optimal Path (Dijkstra)\n";
-        cout << "5. Plan Utility Layout (Kruskal MST)\n";
+        cout << "5. Plan Utility Layout (Kruskal / Prim MST)\n";
         cout << "6. Evaluate Energy Bill (Expression Tree)\n";
-        cout << "7. Exit\n";
+        cout << "7. Benchmark Graph Layouts (Adjacency List vs CSR)\n";
+        cout << "8. Find Path Between Two Buildings\n";
+        cout << "9. Benchmark Routing Queries (Bidirectional / ALT)\n";
+        cout << "10. Contraction Hierarchy (Build/Save/Load/Query)\n";
+        cout << "11. Benchmark Contraction Hierarchy\n";
+        cout << "12. Building Distance Table (All Pairs)\n";
+        cout << "13. Benchmark Distance Matrix\n";
+        cout << "14. Benchmark MST (Kruskal / Prim / Parallel Boruvka)\n";
+        cout << "15. Edit Campus Paths (Add / Close / Reweight)\n";
+        cout << "16. Benchmark Dynamic Path Updates\n";
+        cout << "17. Campus Graph File (Save / Load / Import Edge List)\n";
+        cout << "18. Benchmark Graph File Loading\n";
+        cout << "19. Benchmark Energy Bill Formula (Tree / Bytecode)\n";
+        cout << "20. Exit\n";
         cout << "Enter choice: ";
         cin >> choice;
 
@@ -474,7 +3384,20 @@ int main() {
             case 4: planner.findOptimalPath(); break;
             case 5: planner.planUtilityLayout(); break;
             case 6: planner.evaluateEnergyExpression(); break;
-            case 7: cout << "Exiting...\n"; return 0;
+            case 7: planner.benchmarkLayouts(); break;
+            case 8: planner.findPathBetween(); break;
+            case 9: planner.benchmarkRouting(); break;
+            case 10: planner.contractionHierarchyMenu(); break;
+            case 11: planner.benchmarkHierarchy(); break;
+            case 12: planner.showDistanceTable(); break;
+            case 13: planner.benchmarkMatrix(); break;
+            case 14: planner.benchmarkMST(); break;
+            case 15: planner.editCampusPaths(); break;
+            case 16: planner.benchmarkDynamic(); break;
+            case 17: planner.graphFileMenu(); break;
+            case 18: planner.benchmarkGraphFiles(); break;
+            case 19: planner.benchmarkEnergy(); break;
+            case 20: cout << "Exiting...\n"; return 0;
             default: cout << "Invalid choice.\n";
         }
     }
@@ -1,17 +1,22 @@
 #include <bits/stdc++.h>
 using namespace std;
 
-// ---------------- Ticket ADT (Singly Linked List Node) ----------------
+// ---------------- Ticket ADT ----------------
 
 struct Ticket {
     int ticketID;
     string customerName;
     string issueDescription;
     int priority; // 1 = urgent, higher numbers = lower priority
-    Ticket *next;
     Ticket(int id, const string &name, const string &issue, int pr)
         : ticketID(id), customerName(name), issueDescription(issue),
-          priority(pr), next(nullptr) {}
+          priority(pr) {}
+};
+
+// Stable reference into the ticket store; goes stale once the ticket is deleted
+struct TicketHandle {
+    int slot;
+    unsigned generation;
 };
 
 // ---------------- Polynomial Node for Billing History ----------------
@@ -45,7 +50,7 @@ public:
 struct PQNode {
     int priority;
     int ticketID;
-    Ticket *ref;
+    TicketHandle ref;
     bool operator<(const PQNode &other) const {
         if (priority == other.priority) return ticketID > other.ticketID;
         return priority > other.priority; // smaller priority value = higher priority
@@ -56,22 +61,22 @@ struct PQNode {
 
 class CircularQueue {
     static const int MAXQ = 1000;
-    Ticket *arr[MAXQ];
+    TicketHandle arr[MAXQ];
     int front, rear, count;
 public:
     CircularQueue() : front(0), rear(-1), count(0) {}
     bool isFull() const { return count == MAXQ; }
     bool isEmpty() const { return count == 0; }
-    bool enqueue(Ticket *t) {
+    bool enqueue(TicketHandle t) {
         if (isFull()) return false;
         rear = (rear + 1) % MAXQ;
         arr[rear] = t;
         count++;
         return true;
     }
-    Ticket* dequeue() {
-        if (isEmpty()) return nullptr;
-        Ticket *t = arr[front];
+    TicketHandle dequeue() {
+        if (isEmpty()) return TicketHandle{-1, 0};
+        TicketHandle t = arr[front];
         front = (front + 1) % MAXQ;
         count--;
         return t;
@@ -170,62 +175,150 @@ public:
     }
 };
 
-// ---------------- Ticket List (Singly Linked List) ----------------
+// ---------------- Ticket Store (Slot Map) ----------------
+// Hot fields (ticketID, priority) live in dense arrays scanned by every
+// traversal; the cold strings sit in parallel arrays only touched on print.
+// Deletes leave a hole in the dense arrays (O(1)) and the holes are compacted
+// away once they outnumber live tickets, so iteration order is preserved.
+
+class TicketStore {
+    struct Slot {
+        int dense;            // index into the dense arrays, -1 when free
+        unsigned generation;  // bumped on every free so stale handles fail
+    };
+
+    // hot, scanned on every traversal
+    vector<int> ids;
+    vector<int> priorities;
+    vector<int> denseSlot;    // dense index -> slot, -1 for a hole
+    // cold, only read when a ticket is printed or copied out
+    vector<string> names;
+    vector<string> issues;
+
+    vector<Slot> slots;
+    vector<int> freeSlots;
+    unordered_map<int, int> idToSlot;
+    int holes;
+
+    int denseIndex(TicketHandle h) const {
+        if (h.slot < 0 || h.slot >= (int)slots.size()) return -1;
+        const Slot &s = slots[h.slot];
+        return s.generation == h.generation ? s.dense : -1;
+    }
+
+    void compact() {
+        int k = 0;
+        for (int i = 0; i < (int)ids.size(); i++) {
+            if (denseSlot[i] == -1) continue;
+            if (k != i) {
+                ids[k] = ids[i];
+                priorities[k] = priorities[i];
+                denseSlot[k] = denseSlot[i];
+                names[k] = std::move(names[i]);
+                issues[k] = std::move(issues[i]);
+            }
+            slots[denseSlot[k]].dense = k;
+            k++;
+        }
+        ids.resize(k);
+        priorities.resize(k);
+        denseSlot.resize(k);
+        names.resize(k);
+        issues.resize(k);
+        holes = 0;
+    }
 
-class TicketList {
-    Ticket *head;
 public:
-    TicketList() : head(nullptr) {}
+    TicketStore() : holes(0) {}
 
-    Ticket* find(int id) {
-        Ticket *curr = head;
-        while (curr) {
-            if (curr->ticketID == id) return curr;
-            curr = curr->next;
-        }
-        return nullptr;
+    int size() const { return (int)ids.size() - holes; }
+    bool empty() const { return size() == 0; }
+
+    TicketHandle find(int id) const {
+        auto it = idToSlot.find(id);
+        if (it == idToSlot.end()) return TicketHandle{-1, 0};
+        return TicketHandle{it->second, slots[it->second].generation};
     }
 
+    bool valid(TicketHandle h) const { return denseIndex(h) != -1; }
+
+    // O(1) average: hash lookup for the duplicate check, append to dense arrays
     bool insertTicket(const Ticket &t) {
-        if (find(t.ticketID)) return false;
-        Ticket *node = new Ticket(t.ticketID, t.customerName, t.issueDescription, t.priority);
-        node->next = head;
-        head = node;
+        if (idToSlot.count(t.ticketID)) return false;
+        int slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slot = (int)slots.size();
+            slots.push_back(Slot{-1, 0});
+        }
+        slots[slot].dense = (int)ids.size();
+        ids.push_back(t.ticketID);
+        priorities.push_back(t.priority);
+        denseSlot.push_back(slot);
+        names.push_back(t.customerName);
+        issues.push_back(t.issueDescription);
+        idToSlot[t.ticketID] = slot;
         return true;
     }
 
+    // O(1) amortised: punch a hole, compact once holes outnumber live tickets
     bool deleteTicket(int id, Ticket &deletedCopy) {
-        Ticket *curr = head, *prev = nullptr;
-        while (curr && curr->ticketID != id) {
-            prev = curr;
-            curr = curr->next;
-        }
-        if (!curr) return false;
-        deletedCopy = *curr;
-        if (prev) prev->next = curr->next;
-        else head = curr->next;
-        delete curr;
+        auto it = idToSlot.find(id);
+        if (it == idToSlot.end()) return false;
+        int slot = it->second;
+        int d = slots[slot].dense;
+        deletedCopy = Ticket(ids[d], names[d], issues[d], priorities[d]);
+
+        denseSlot[d] = -1;
+        names[d].clear();
+        issues[d].clear();
+        holes++;
+        slots[slot].dense = -1;
+        slots[slot].generation++;
+        freeSlots.push_back(slot);
+        idToSlot.erase(it);
+
+        if (holes > size()) compact();
         return true;
     }
 
-    Ticket* retrieveTicket(int id) {
-        return find(id);
+    bool retrieveTicket(int id, Ticket &out) const {
+        TicketHandle h = find(id);
+        int d = denseIndex(h);
+        if (d == -1) return false;
+        out = Ticket(ids[d], names[d], issues[d], priorities[d]);
+        return true;
     }
 
-    Ticket* getHead() { return head; }
+    int ticketID(TicketHandle h) const { return ids[denseIndex(h)]; }
+    int priority(TicketHandle h) const { return priorities[denseIndex(h)]; }
+    const string& customerName(TicketHandle h) const { return names[denseIndex(h)]; }
+    const string& issueDescription(TicketHandle h) const { return issues[denseIndex(h)]; }
+
+    // Visits live tickets newest first (the order the old linked list used),
+    // reading only the hot arrays: visit(handle, ticketID, priority)
+    template <typename Visit>
+    void forEach(Visit visit) const {
+        for (int i = (int)ids.size() - 1; i >= 0; i--) {
+            int slot = denseSlot[i];
+            if (slot == -1) continue;
+            visit(TicketHandle{slot, slots[slot].generation}, ids[i], priorities[i]);
+        }
+    }
 
-    void printAll() {
-        Ticket *curr = head;
-        if (!curr) {
+    void printAll() const {
+        if (empty()) {
             cout << "No tickets in the system.\n";
             return;
         }
-        while (curr) {
-            cout << "TicketID: " << curr->ticketID
-                 << ", Customer: " << curr->customerName
-                 << ", Priority: " << curr->priority
-                 << ", Issue: " << curr->issueDescription << "\n";
-            curr = curr->next;
+        for (int i = (int)ids.size() - 1; i >= 0; i--) {
+            if (denseSlot[i] == -1) continue;
+            cout << "TicketID: " << ids[i]
+                 << ", Customer: " << names[i]
+                 << ", Priority: " << priorities[i]
+                 << ", Issue: " << issues[i] << "\n";
         }
     }
 };
@@ -233,7 +326,7 @@ public:
 // ---------------- Customer Support Ticket System ----------------
 
 class CustomerSupportSystem {
-    TicketList ticketList;
+    TicketStore tickets;
     UndoStack undoStack;
     priority_queue<PQNode> pq;
     CircularQueue cq;
@@ -254,7 +347,7 @@ public:
         cin >> pr;
 
         Ticket t(id, name, issue, pr);
-        if (ticketList.insertTicket(t)) {
+        if (tickets.insertTicket(t)) {
             undoStack.push(UndoOperation("INSERT", t));
             cout << "Ticket inserted.\n";
         } else {
@@ -272,13 +365,13 @@ public:
 
         if (u.opType == "INSERT") {
             Ticket dummy(0,"","",0);
-            if (ticketList.deleteTicket(u.data.ticketID, dummy)) {
+            if (tickets.deleteTicket(u.data.ticketID, dummy)) {
                 cout << "Undo: Insert reverted, ticket removed.\n";
             } else {
                 cout << "Undo failed: ticket not found.\n";
             }
         } else if (u.opType == "DELETE") {
-            if (ticketList.insertTicket(u.data)) {
+            if (tickets.insertTicket(u.data)) {
                 cout << "Undo: Delete reverted, ticket reinserted.\n";
             } else {
                 cout << "Undo failed: duplicate TicketID.\n";
@@ -288,11 +381,9 @@ public:
 
     void processPriorityTickets() {
         pq = priority_queue<PQNode>();
-        Ticket *curr = ticketList.getHead();
-        while (curr) {
-            pq.push(PQNode{curr->priority, curr->ticketID, curr});
-            curr = curr->next;
-        }
+        tickets.forEach([&](TicketHandle h, int id, int pr) {
+            pq.push(PQNode{pr, id, h});
+        });
         if (pq.empty()) {
             cout << "No tickets to process.\n";
             return;
@@ -303,17 +394,15 @@ public:
             pq.pop();
             cout << "Processing TicketID: " << top.ticketID
                  << ", Priority: " << top.priority
-                 << ", Customer: " << top.ref->customerName << "\n";
+                 << ", Customer: " << tickets.customerName(top.ref) << "\n";
         }
     }
 
     void processRoundRobinTickets() {
         cq = CircularQueue();
-        Ticket *curr = ticketList.getHead();
-        while (curr) {
-            cq.enqueue(curr);
-            curr = curr->next;
-        }
+        tickets.forEach([&](TicketHandle h, int, int) {
+            cq.enqueue(h);
+        });
         if (cq.isEmpty()) {
             cout << "No tickets for round-robin.\n";
             return;
@@ -323,9 +412,9 @@ public:
         cin >> quantum;
         cout << "Round-robin order:\n";
         for (int i = 0; i < quantum && !cq.isEmpty(); i++) {
-            Ticket *t = cq.dequeue();
-            cout << "Cycle " << (i + 1) << " -> TicketID: " << t->ticketID
-                 << ", Customer: " << t->customerName << "\n";
+            TicketHandle t = cq.dequeue();
+            cout << "Cycle " << (i + 1) << " -> TicketID: " << tickets.ticketID(t)
+                 << ", Customer: " << tickets.customerName(t) << "\n";
             cq.enqueue(t);
         }
     }
@@ -358,13 +447,13 @@ public:
         int id;
         cout << "Enter TicketID to retrieve: ";
         cin >> id;
-        Ticket *t = ticketList.retrieveTicket(id);
-        if (!t) cout << "Ticket not found.\n";
+        Ticket t(0,"","",0);
+        if (!tickets.retrieveTicket(id, t)) cout << "Ticket not found.\n";
         else {
-            cout << "TicketID: " << t->ticketID
-                 << ", Customer: " << t->customerName
-                 << ", Priority: " << t->priority
-                 << ", Issue: " << t->issueDescription << "\n";
+            cout << "TicketID: " << t.ticketID
+                 << ", Customer: " << t.customerName
+                 << ", Priority: " << t.priority
+                 << ", Issue: " << t.issueDescription << "\n";
         }
     }
 
@@ -373,7 +462,7 @@ public:
         cout << "Enter TicketID to delete: ";
         cin >> id;
         Ticket deletedCopy(0,"","",0);
-        if (ticketList.deleteTicket(id, deletedCopy)) {
+        if (tickets.deleteTicket(id, deletedCopy)) {
             undoStack.push(UndoOperation("DELETE", deletedCopy));
             cout << "Ticket deleted.\n";
         } else {
@@ -382,7 +471,7 @@ public:
     }
 
     void displayAllTickets() {
-        ticketList.printAll();
+        tickets.printAll();
     }
 };
 